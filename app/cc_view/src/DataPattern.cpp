@@ -0,0 +1,240 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "DataPattern.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <utility>
+
+#include "cc_tools_qt/property/message.h"
+#include "search.h"
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const std::uint8_t FullMask = 0xff;
+
+bool isSeparator(QChar ch)
+{
+    return ch.isSpace() || (ch == ',') || (ch == ':') || (ch == '-');
+}
+
+} // namespace
+
+DataPattern::~DataPattern() noexcept = default;
+
+DataPattern::Ptr DataPattern::compile(const QString& pattern, QString& error)
+{
+    auto str = pattern.trimmed().toLower();
+    str.remove("0x");
+
+    QString nibbles;
+    for (auto ch : str) {
+        if (isSeparator(ch)) {
+            continue;
+        }
+
+        if ((!ch.isDigit()) && ((ch < 'a') || ('f' < ch)) && (ch != '?')) {
+            error = QString("Invalid character \"%1\"").arg(ch);
+            return Ptr();
+        }
+
+        nibbles.append(ch);
+    }
+
+    if (nibbles.isEmpty()) {
+        error = "Empty pattern";
+        return Ptr();
+    }
+
+    if ((nibbles.size() & 0x1) != 0) {
+        error = "Incomplete byte, odd number of hex digits";
+        return Ptr();
+    }
+
+    DataSeq bytes;
+    DataSeq mask;
+    bytes.reserve(static_cast<std::size_t>(nibbles.size() / 2));
+    mask.reserve(bytes.capacity());
+    for (auto idx = 0; idx < nibbles.size(); idx += 2) {
+        unsigned byte = 0U;
+        unsigned byteMask = 0U;
+        for (auto nibbleIdx = idx; nibbleIdx < (idx + 2); ++nibbleIdx) {
+            byte <<= 4;
+            byteMask <<= 4;
+            auto ch = nibbles[nibbleIdx];
+            if (ch == '?') {
+                continue;
+            }
+
+            byte |= static_cast<unsigned>(QString(ch).toUInt(nullptr, 16));
+            byteMask |= 0xfU;
+        }
+
+        bytes.push_back(static_cast<std::uint8_t>(byte));
+        mask.push_back(static_cast<std::uint8_t>(byteMask));
+    }
+
+    if (std::all_of(mask.begin(), mask.end(), [](std::uint8_t m) { return m == 0U; })) {
+        error = "Pattern must contain at least one defined nibble";
+        return Ptr();
+    }
+
+    return Ptr(new DataPattern(pattern.trimmed(), std::move(bytes), std::move(mask)));
+}
+
+std::size_t DataPattern::find(const std::uint8_t* data, std::size_t len) const
+{
+    auto patLen = m_bytes.size();
+    if ((data == nullptr) || (len < patLen)) {
+        return NotFound;
+    }
+
+    if (m_anchorLen == 0U) {
+        // No fully defined byte, check every position
+        for (std::size_t offset = 0U; offset <= (len - patLen); ++offset) {
+            if (matchesAt(data + offset)) {
+                return offset;
+            }
+        }
+
+        return NotFound;
+    }
+
+    auto* searchEnd = data + (len - (patLen - m_anchorPos - m_anchorLen));
+    auto* searchFrom = data + m_anchorPos;
+    while (searchFrom < searchEnd) {
+        auto* found = m_anchorSearch(searchFrom, searchEnd);
+        if (found == searchEnd) {
+            break;
+        }
+
+        auto* start = found - m_anchorPos;
+        if ((m_anchorLen == patLen) || matchesAt(start)) {
+            return static_cast<std::size_t>(start - data);
+        }
+
+        searchFrom = found + 1;
+    }
+
+    return NotFound;
+}
+
+std::size_t DataPattern::find(const ToolsMessage& msg) const
+{
+    auto rawDataMsg = property::message::ToolsMsgRawDataMsg().getFrom(msg);
+    if (!rawDataMsg) {
+        return NotFound;
+    }
+
+    // The raw data message contains single raw data field, search its
+    // storage in place instead of serializing the message.
+    auto& descriptors = rawDataMsg->fieldDescriptors();
+    if ((descriptors.size() == 1U) && (descriptors.front().m_dataFunc != nullptr)) {
+        auto view = descriptors.front().m_dataFunc(*rawDataMsg);
+        if (view.m_size == 0U) {
+            return NotFound;
+        }
+
+        return find(view.m_data, view.m_size);
+    }
+
+    auto data = rawDataMsg->encodeData();
+    if (data.empty()) {
+        return NotFound;
+    }
+
+    return find(data.data(), data.size());
+}
+
+int DataPattern::find(const MsgsList& msgs, int from, bool forward) const
+{
+    return
+        search::findMsg(
+            msgs, from, forward,
+            [this](const ToolsMessage& msg)
+            {
+                return find(msg) != NotFound;
+            });
+}
+
+DataPattern::DataPattern(const QString& pattern, DataSeq&& bytes, DataSeq&& mask) :
+    m_pattern(pattern),
+    m_bytes(std::move(bytes)),
+    m_mask(std::move(mask))
+{
+    assert(m_bytes.size() == m_mask.size());
+
+    // The longest sequence of fully defined bytes is used as an anchor
+    std::size_t runPos = 0U;
+    std::size_t runLen = 0U;
+    for (std::size_t idx = 0U; idx < m_mask.size(); ++idx) {
+        if (m_mask[idx] != FullMask) {
+            runLen = 0U;
+            continue;
+        }
+
+        if (runLen == 0U) {
+            runPos = idx;
+        }
+
+        ++runLen;
+        if (m_anchorLen < runLen) {
+            m_anchorPos = runPos;
+            m_anchorLen = runLen;
+        }
+    }
+
+    if (m_anchorLen == 0U) {
+        return;
+    }
+
+    auto* anchorBegin = m_bytes.data() + m_anchorPos;
+    auto* anchorEnd = anchorBegin + m_anchorLen;
+    if (m_anchorLen == 1U) {
+        m_anchorSearch =
+            [value = *anchorBegin](const std::uint8_t* begin, const std::uint8_t* end)
+            {
+                return std::find(begin, end, value);
+            };
+        return;
+    }
+
+    m_anchorSearch =
+        [searcher = std::boyer_moore_horspool_searcher<const std::uint8_t*>(anchorBegin, anchorEnd)](const std::uint8_t* begin, const std::uint8_t* end)
+        {
+            return std::search(begin, end, searcher);
+        };
+}
+
+bool DataPattern::matchesAt(const std::uint8_t* data) const
+{
+    for (std::size_t idx = 0U; idx < m_bytes.size(); ++idx) {
+        if ((data[idx] & m_mask[idx]) != m_bytes[idx]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace cc_tools_qt
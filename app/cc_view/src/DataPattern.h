@@ -0,0 +1,95 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QMetaType>
+#include <QtCore/QString>
+
+#include "cc_tools_qt/ToolsMessage.h"
+
+namespace cc_tools_qt
+{
+
+/// @brief Byte pattern to search in the raw data of the messages.
+/// @details The pattern is expressed as hex string, where '?' is a
+///     wildcard for a single nibble, e.g. "01 ?? a? ff". The longest
+///     sequence of the fully specified bytes is searched using
+///     Boyer-Moore-Horspool algorithm, while the rest of the pattern
+///     is checked only for the found candidates.
+class DataPattern
+{
+public:
+    using Ptr = std::shared_ptr<const DataPattern>;
+    using DataSeq = ToolsMessage::DataSeq;
+    using MsgsList = std::vector<const ToolsMessage*>; ///< Kept alive by the caller
+
+    static const std::size_t NotFound = std::numeric_limits<std::size_t>::max();
+
+    ~DataPattern() noexcept;
+
+    DataPattern(const DataPattern&) = delete;
+    DataPattern& operator=(const DataPattern&) = delete;
+
+    static Ptr compile(const QString& pattern, QString& error);
+
+    const QString& pattern() const
+    {
+        return m_pattern;
+    }
+
+    std::size_t size() const
+    {
+        return m_bytes.size();
+    }
+
+    /// @brief Find the offset of the first match in the provided buffer.
+    /// @return Offset of the match, @ref NotFound if there is none.
+    std::size_t find(const std::uint8_t* data, std::size_t len) const;
+
+    /// @brief Find the offset of the first match in the raw data of the message.
+    std::size_t find(const ToolsMessage& msg) const;
+
+    /// @brief Find the first message, raw data of which contains the
+    ///     pattern, starting from (and including) the provided position.
+    /// @return Index of the found message, -1 if not found.
+    int find(const MsgsList& msgs, int from, bool forward) const;
+
+private:
+    using SearchFunc = std::function<const std::uint8_t* (const std::uint8_t* begin, const std::uint8_t* end)>;
+
+    DataPattern(const QString& pattern, DataSeq&& bytes, DataSeq&& mask);
+    bool matchesAt(const std::uint8_t* data) const;
+
+    QString m_pattern;
+    DataSeq m_bytes;
+    DataSeq m_mask;
+    std::size_t m_anchorPos = 0U;
+    std::size_t m_anchorLen = 0U;
+    SearchFunc m_anchorSearch;
+};
+
+}  // namespace cc_tools_qt
+
+Q_DECLARE_METATYPE(cc_tools_qt::DataPattern::Ptr);
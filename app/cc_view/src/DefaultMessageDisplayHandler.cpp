@@ -17,7 +17,9 @@
 
 #include "DefaultMessageDisplayHandler.h"
 
+#include <algorithm>
 #include <cassert>
+#include <typeinfo>
 
 #include <QtWidgets/QApplication>
 
@@ -43,16 +45,28 @@ namespace cc_tools_qt
 namespace
 {
 
+// Last used widgets trees are kept for reuse, the widget of the
+// previously displayed message is expected to be among them.
+const std::size_t MaxCachedWidgets = 16U;
+static_assert(2U <= MaxCachedWidgets, "Previously displayed widget must be cached");
+
+QWidget* defaultParent()
+{
+    auto widgets = qApp->topLevelWidgets();
+    if (widgets.isEmpty()) {
+        return nullptr;
+    }
+
+    return widgets[0];
+}
+
 class WidgetCreator : public ToolsFieldHandler
 {
 public:
 
-    WidgetCreator()
+    explicit WidgetCreator(QWidget* parentObj) :
+        m_parent(parentObj)
     {
-        auto widgets = qApp->topLevelWidgets();
-        if (!widgets.isEmpty()) {
-            m_parent = widgets[0];
-        }
     }
 
     virtual void handle(field::ToolsIntField& field) override
@@ -134,10 +148,10 @@ public:
     virtual void handle(field::ToolsArrayListField& field) override
     {
         auto createMembersWidgetsFunc =
-            [](field::ToolsArrayListField& fieldParam) -> std::vector<FieldWidgetPtr>
+            [widgetsParent = m_parent](field::ToolsArrayListField& fieldParam) -> std::vector<FieldWidgetPtr>
             {
                 std::vector<FieldWidgetPtr> allFieldsWidgets;
-                WidgetCreator otherCreator;
+                WidgetCreator otherCreator(widgetsParent);
                 auto& members = fieldParam.getMembers();
                 allFieldsWidgets.reserve(members.size());
                 assert(members.size() == fieldParam.size());
@@ -163,9 +177,9 @@ public:
     virtual void handle(field::ToolsVariantField& field) override
     {
         auto createMemberWidgetsFunc =
-            [](ToolsField& wrap) -> FieldWidgetPtr
+            [widgetsParent = m_parent](ToolsField& wrap) -> FieldWidgetPtr
             {
-                WidgetCreator otherCreator;
+                WidgetCreator otherCreator(widgetsParent);
                 wrap.dispatch(otherCreator);
                 return otherCreator.getWidget();
             };
@@ -214,21 +228,72 @@ private:
 
 DefaultMessageDisplayHandler::~DefaultMessageDisplayHandler() noexcept = default;
 
-DefaultMessageDisplayHandler::MsgWidgetPtr DefaultMessageDisplayHandler::getMsgWidget(ToolsMessage& msg)
+MessageWidget* DefaultMessageDisplayHandler::getMsgWidget(const ToolsMessagePtr& msg, bool& sameWidget)
+{
+    assert(msg);
+    sameWidget = false;
+    auto transportFields = msg->cachedTransportFields();
+    auto payloadFields = msg->cachedPayloadFields();
+    assert(transportFields && payloadFields);
+    std::type_index msgType(typeid(*msg));
+    auto iter =
+        std::find_if(
+            m_cache.begin(), m_cache.end(),
+            [&msgType](const CachedWidget& elem)
+            {
+                return elem.first == msgType;
+            });
+
+    if (iter != m_cache.end()) {
+        // The front widget is the one returned last time
+        bool wasFront = (iter == m_cache.begin());
+
+        // Move to front as most recently used
+        m_cache.splice(m_cache.begin(), m_cache, iter);
+        auto& cachedWidget = m_cache.front().second;
+        assert(cachedWidget);
+        if (cachedWidget->rebind(*msg, transportFields, payloadFields)) {
+            sameWidget = wasFront;
+            return cachedWidget.get();
+        }
+
+        // Partially rebound widget cannot be reused. It can still be
+        // displayed, the destruction is postponed to allow the caller
+        // to detach it first.
+        cachedWidget.release()->deleteLater();
+        m_cache.pop_front();
+    }
+
+    m_cache.emplace_front(msgType, createMsgWidget(*msg, *transportFields, *payloadFields));
+    while (MaxCachedWidgets < m_cache.size()) {
+        m_cache.pop_back();
+    }
+
+    return m_cache.front().second.get();
+}
+
+void DefaultMessageDisplayHandler::clear()
+{
+    m_cache.clear();
+}
+
+DefaultMessageDisplayHandler::DefaultMsgWidgetPtr DefaultMessageDisplayHandler::createMsgWidget(
+    ToolsMessage& msg,
+    const ToolsMessage::FieldsList& transportFields,
+    const ToolsMessage::FieldsList& payloadFields)
 {
     auto widget = std::make_unique<DefaultMessageWidget>(msg);
+    auto* parentObj = defaultParent();
 
-    auto transportFields = msg.transportFields();
     for (auto& f : transportFields) {
-        WidgetCreator creator;
+        WidgetCreator creator(parentObj);
         f->dispatch(creator);
         auto fieldWidget = creator.getWidget();
         widget->addExtraTransportFieldWidget(fieldWidget.release());
     }
 
-    auto fields = msg.payloadFields();
-    for (auto& f : fields) {
-        WidgetCreator creator;
+    for (auto& f : payloadFields) {
+        WidgetCreator creator(parentObj);
         f->dispatch(creator);
         auto fieldWidget = creator.getWidget();
         widget->addFieldWidget(fieldWidget.release());
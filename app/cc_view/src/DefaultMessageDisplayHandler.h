@@ -18,7 +18,11 @@
 #pragma once
 
 #include <cassert>
+#include <list>
+#include <memory>
 #include <type_traits>
+#include <typeindex>
+#include <utility>
 
 #include <QtWidgets/QVBoxLayout>
 
@@ -33,11 +37,31 @@ namespace cc_tools_qt
 class DefaultMessageDisplayHandler
 {
 public:
-    using MsgWidgetPtr = std::unique_ptr<MessageWidget>;
-
     ~DefaultMessageDisplayHandler() noexcept;
 
-    static MsgWidgetPtr getMsgWidget(ToolsMessage& msg);
+    /// @brief Get widget displaying the message.
+    /// @details The widgets are owned by the handler and cached per message type.
+    ///     The cached widget is bound to the fields of the provided message
+    ///     instead of recreating the whole widgets tree.
+    /// @param[in] msg Message to display.
+    /// @param[out] sameWidget Reports whether the returned widget is the same
+    ///     one that was returned by the previous invocation.
+    MessageWidget* getMsgWidget(const ToolsMessagePtr& msg, bool& sameWidget);
+
+    /// @brief Destroy all the cached widgets.
+    void clear();
+
+private:
+    using DefaultMsgWidgetPtr = std::unique_ptr<DefaultMessageWidget>;
+    using CachedWidget = std::pair<std::type_index, DefaultMsgWidgetPtr>;
+    using CachedWidgetsList = std::list<CachedWidget>;
+
+    static DefaultMsgWidgetPtr createMsgWidget(
+        ToolsMessage& msg,
+        const ToolsMessage::FieldsList& transportFields,
+        const ToolsMessage::FieldsList& payloadFields);
+
+    CachedWidgetsList m_cache;
 };
 
 }  // namespace cc_tools_qt
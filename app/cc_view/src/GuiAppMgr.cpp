@@ -17,8 +17,12 @@
 
 #include "GuiAppMgr.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <iterator>
 #include <memory>
+#include <thread>
 
 #include <QtCore/QTimer>
 #include <QtCore/QStandardPaths>
@@ -77,7 +81,13 @@ GuiAppMgr& GuiAppMgr::instanceRef()
     return mgr;
 }
 
-GuiAppMgr::~GuiAppMgr() noexcept = default;
+GuiAppMgr::~GuiAppMgr() noexcept
+{
+    cancelRecvListRebuild();
+    for (auto& f : m_recvListRebuilds) {
+        f.wait();
+    }
+}
 
 bool GuiAppMgr::startClean()
 {
@@ -127,12 +137,59 @@ void GuiAppMgr::setFilteredMessages(FilteredMessages&& filteredMessages)
     }
 
     m_filteredMessages = std::move(filteredMessages);
+    updateRecvListFilter();
 
     if (recvListApplyFilter()) {
         refreshRecvList();
     }
 }
 
+const MsgQuery::Ptr& GuiAppMgr::getRecvListQuery() const
+{
+    return m_recvListQuery;
+}
+
+void GuiAppMgr::setRecvListQuery(MsgQuery::Ptr query)
+{
+    auto getExpr =
+        [](const MsgQuery::Ptr& ptr)
+        {
+            if (!ptr) {
+                return QString();
+            }
+
+            return ptr->expression();
+        };
+
+    if (getExpr(query) == getExpr(m_recvListQuery)) {
+        return;
+    }
+
+    m_recvListQuery = std::move(query);
+    m_recvFindData = false;
+    updateRecvListFilter();
+
+    if (recvListApplyFilter()) {
+        refreshRecvList();
+    }
+}
+
+const DataPattern::Ptr& GuiAppMgr::getRecvDataPattern() const
+{
+    return m_recvDataPattern;
+}
+
+void GuiAppMgr::setRecvDataPattern(DataPattern::Ptr pattern)
+{
+    m_recvDataPattern = std::move(pattern);
+    m_recvFindData = static_cast<bool>(m_recvDataPattern);
+}
+
+void GuiAppMgr::recvDataMatchSelected(int offset, int length)
+{
+    emit sigDisplayDataHighlight(offset, length);
+}
+
 QString GuiAppMgr::messageDesc(const ToolsMessage& msg)
 {
     return QString("(%1) %2").arg(msg.idAsString()).arg(msg.name());
@@ -195,10 +252,16 @@ void GuiAppMgr::recvDeleteClicked()
     assert(m_clickedMsg);
 
     MsgMgrG::instanceRef().deleteMsg(m_clickedMsg);
+    removeRecvListEntries(ToolsMessagesList{m_clickedMsg});
 
     clearDisplayedMessage();
     emit sigRecvDeleteSelectedMsg();
     decRecvListCount();
+
+    if (m_recvListRebuildInProgress) {
+        // The index being built may still reference the deleted message
+        refreshRecvList();
+    }
 }
 
 void GuiAppMgr::recvClearClicked()
@@ -232,6 +295,16 @@ void GuiAppMgr::recvApplyFilterToggled(bool checked)
     updateRecvListMode(RecvListMode_ApplyFilter, checked);
 }
 
+void GuiAppMgr::recvFindNextClicked()
+{
+    recvFind(true);
+}
+
+void GuiAppMgr::recvFindPrevClicked()
+{
+    recvFind(false);
+}
+
 void GuiAppMgr::sendStartClicked()
 {
     m_sendState = SendState::SendingSingle;
@@ -244,6 +317,13 @@ void GuiAppMgr::sendStartAllClicked()
     emitSendStateUpdate();
 }
 
+void GuiAppMgr::sendStartBurstClicked(unsigned count)
+{
+    m_sendBurstCount = count;
+    m_sendState = SendState::SendingBurst;
+    emitSendStateUpdate();
+}
+
 void GuiAppMgr::sendStopClicked()
 {
     m_sendState = SendState::Idle;
@@ -431,6 +511,7 @@ void GuiAppMgr::recvLoadMsgsFromFile(const QString& filename)
     auto msgs = MsgFileMgrG::instanceRef().load(ToolsMsgFileMgr::Type::Recv, filename, *msgMgr.getProtocol());
 
     clearRecvList(false);
+    clearRecvListEntries();
     msgMgr.deleteAllMsgs();
 
     msgMgr.addMsgs(msgs);
@@ -537,18 +618,36 @@ void GuiAppMgr::deleteMessages(ToolsMessagesList&& msgs)
 {
     auto& msgMgr = MsgMgrG::instanceRef();
     if (msgMgr.getAllMsgs().size() == msgs.size()) {
+        clearRecvListEntries();
+        msgs.clear(); // Allow the recycled messages to be released
         msgMgr.deleteAllMsgs();
         return;
     }
 
+    removeRecvListEntries(msgs);
     msgMgr.deleteMsgs(msgs);
 }
 
 void GuiAppMgr::sendMessages(ToolsMessagesList&& msgs)
 {
+    if (m_sendState == SendState::SendingBurst) {
+        m_sendMgr.startBurst(MsgMgrG::instanceRef().getProtocol(), msgs, m_sendBurstCount);
+        return;
+    }
+
     m_sendMgr.start(MsgMgrG::instanceRef().getProtocol(), std::move(msgs));
 }
 
+ToolsMsgSendMgr::TimingStatsList GuiAppMgr::sendTimingStats() const
+{
+    return m_sendMgr.getTimingStats();
+}
+
+bool GuiAppMgr::isSendPaused() const
+{
+    return m_sendMgr.isPaused();
+}
+
 GuiAppMgr::ActivityState GuiAppMgr::getActivityState()
 {
     auto& pluginMgr = PluginMgrG::instanceRef();
@@ -584,6 +683,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
     if (hasApplied) {
         if (needsReload) {
             clearRecvList(false);
+            clearRecvListEntries();
             msgMgr.deleteAllMsgs();
         }
 
@@ -671,6 +771,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
     }
 
     msgMgr.setProtocol(std::move(applyInfo.m_protocol));
+    updateRecvListFilter();
 
     msgMgr.start();
     emit sigActivityStateChanged(static_cast<int>(ActivityState::Active));
@@ -730,6 +831,13 @@ GuiAppMgr::GuiAppMgr(QObject* parentObj)
             emit sigSocketConnected(connected);
         });
 
+    msgMgr.setSocketWriteBlockedReportCallbackFunc(
+        [this](bool blocked)
+        {
+            // Let the socket drain instead of growing its write buffer
+            m_sendMgr.setPaused(blocked);
+        });
+
     refreshRecvState();
 }
 
@@ -762,7 +870,11 @@ void GuiAppMgr::msgAdded(ToolsMessagePtr msg)
     std::cout << '[' << property::message::ToolsMsgTimestamp().getFrom(*msg) << "] " << prefix << msg->name() << std::endl;
 #endif
 
-    if (!canAddToRecvList(*msg, type)) {
+    auto entry = makeRecvListEntry(msg, type);
+    assert(m_recvListFilter);
+    bool canAdd = canAddToRecvList(entry, m_recvListMode, *m_recvListFilter);
+    addRecvListEntry(std::move(entry));
+    if (!canAdd) {
         return;
     }
 
@@ -828,10 +940,74 @@ void GuiAppMgr::clearDisplayedMessage()
 
 void GuiAppMgr::refreshRecvList()
 {
-    auto clickedMsg = m_clickedMsg;
+    cancelRecvListRebuild();
+
+    // The finished ones are released without blocking the GUI thread
+    m_recvListRebuilds.remove_if(
+        [](auto& f)
+        {
+            return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+
+    // Only the chunk being filled is copied, the rest are shared
+    auto snapshot = std::make_shared<RecvListSnapshot>();
+    snapshot->reserve(m_recvListChunks.size() + 1U);
+    snapshot->assign(m_recvListChunks.begin(), m_recvListChunks.end());
+    if (!m_recvListTail.empty()) {
+        snapshot->push_back(std::make_shared<const RecvListChunk>(m_recvListTail));
+    }
+
+    auto cancelled = std::make_shared<std::atomic<bool>>(false);
+    m_recvListRebuildCancelled = cancelled;
+    m_recvListRebuildInProgress = true;
+
+    // The new index is built in the background while the currently displayed
+    // list keeps receiving new messages. The latter are also recorded in
+    // m_recvListRebuildPending to be appended to the new index when it's ready.
+    m_recvListRebuilds.push_back(
+        std::async(
+            std::launch::async,
+            [this,
+             snapshotPtr = std::move(snapshot),
+             cancelledPtr = std::move(cancelled),
+             generation = m_recvListGeneration,
+             mode = m_recvListMode,
+             filter = m_recvListFilter]() mutable
+            {
+                auto index =
+                    std::make_shared<MsgsIndex>(
+                        buildRecvListIndex(*snapshotPtr, mode, filter, *cancelledPtr));
+
+                // The snapshot is passed back to make sure the messages are
+                // released by the GUI thread.
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, msgs = std::move(snapshotPtr), generation, indexPtr = std::move(index)]() mutable
+                    {
+                        msgs.reset();
+                        recvListIndexBuilt(generation, std::move(indexPtr));
+                    },
+                    Qt::QueuedConnection);
+            }));
+}
+
+void GuiAppMgr::recvListIndexBuilt(unsigned generation, MsgsIndexPtr index)
+{
+    if ((!m_recvListRebuildInProgress) || (generation != m_recvListGeneration)) {
+        return;
+    }
+
+    assert(index);
+    m_recvListRebuildInProgress = false;
+    m_recvListRebuildCancelled.reset();
+    index->insert(index->end(), m_recvListRebuildPending.begin(), m_recvListRebuildPending.end());
+    m_recvListRebuildPending.clear();
+
+    ToolsMessagePtr clickedMsg;
     if (m_selType == SelectionType::Recv) {
         assert(m_clickedMsg);
         assert(0 < m_recvListCount);
+        clickedMsg = m_clickedMsg;
         recvMsgClicked(m_clickedMsg, static_cast<int>(m_recvListCount) - 1);
         assert(!m_clickedMsg);
     }
@@ -839,30 +1015,52 @@ void GuiAppMgr::refreshRecvList()
         emit sigClearDisplayedMsg();
     }
 
-    clearRecvList(false);
-
-    auto& allMsgs = MsgMgrG::instanceRef().getAllMsgs();
-    for (auto& msg : allMsgs) {
-        assert(msg);
-        auto type = property::message::ToolsMsgType().getFrom(*msg);
-
-        if (canAddToRecvList(*msg, type)) {
-            addMsgToRecvList(msg);
-            if (msg == clickedMsg) {
-                assert(0 < m_recvListCount);
-                recvMsgClicked(msg, static_cast<int>(m_recvListCount) - 1);
-            }
+    int clickedIdx = -1;
+    if (clickedMsg) {
+        auto iter = std::find(index->begin(), index->end(), clickedMsg);
+        if (iter != index->end()) {
+            clickedIdx = static_cast<int>(std::distance(index->begin(), iter));
         }
     }
 
+    m_recvListCount = static_cast<decltype(m_recvListCount)>(index->size());
+    emit sigRecvListCountReport(m_recvListCount);
+    emit sigRecvListReset(std::move(index));
+
+    if (0 <= clickedIdx) {
+        recvMsgClicked(clickedMsg, clickedIdx);
+    }
+
+    if (m_recvFoundMsg && m_recvDataPattern) {
+        emit sigRecvFoundData(std::move(m_recvFoundMsg), m_recvDataPattern);
+    }
+
+    m_recvFoundMsg.reset();
+
     if (!m_clickedMsg) {
         emit sigRecvMsgListClearSelection();
     }
 }
 
+void GuiAppMgr::cancelRecvListRebuild()
+{
+    if (m_recvListRebuildCancelled) {
+        *m_recvListRebuildCancelled = true;
+        m_recvListRebuildCancelled.reset();
+    }
+
+    ++m_recvListGeneration;
+    m_recvListRebuildInProgress = false;
+    m_recvListRebuildPending.clear();
+}
+
 void GuiAppMgr::addMsgToRecvList(ToolsMessagePtr msg)
 {
     assert(msg);
+    if (m_recvListRebuildInProgress) {
+        m_recvListRebuildPending.push_back(msg);
+    }
+
     ++m_recvListCount;
     emit sigRecvListCountReport(m_recvListCount);
     emit sigAddRecvMsg(msg);
@@ -870,6 +1068,8 @@ void GuiAppMgr::addMsgToRecvList(ToolsMessagePtr msg)
 
 void GuiAppMgr::clearRecvList(bool reportDeleted)
 {
+    cancelRecvListRebuild();
+
     bool wasSelected = (m_selType == SelectionType::Recv);
     bool sendSelected = (m_selType == SelectionType::Send);
     assert((!wasSelected) || (m_clickedMsg));
@@ -890,32 +1090,302 @@ void GuiAppMgr::clearRecvList(bool reportDeleted)
     emit sigRecvClear(reportDeleted);
 }
 
+void GuiAppMgr::addRecvListEntry(RecvListEntry&& entry)
+{
+    static const std::size_t RecvListChunkSize = 64U * 1024U;
+    if (m_recvListTail.empty()) {
+        m_recvListTail.reserve(RecvListChunkSize);
+    }
+
+    m_recvListTail.push_back(std::move(entry));
+    if (m_recvListTail.size() < RecvListChunkSize) {
+        return;
+    }
+
+    m_recvListChunks.push_back(std::make_shared<const RecvListChunk>(std::move(m_recvListTail)));
+    m_recvListTail = RecvListChunk();
+}
+
+void GuiAppMgr::removeRecvListEntries(const ToolsMessagesList& msgs)
+{
+    if (msgs.empty()) {
+        return;
+    }
+
+    std::unordered_set<const ToolsMessage*> removed;
+    removed.reserve(msgs.size());
+    for (auto& m : msgs) {
+        removed.insert(m.get());
+    }
+
+    // Deleting messages is rare, the chunks are recreated
+    auto chunks = std::move(m_recvListChunks);
+    auto tail = std::move(m_recvListTail);
+    clearRecvListEntries();
+
+    auto addFunc =
+        [this, &removed](const RecvListChunk& chunk)
+        {
+            for (auto& entry : chunk) {
+                if (removed.find(entry.m_msg.get()) == removed.end()) {
+                    addRecvListEntry(RecvListEntry(entry));
+                }
+            }
+        };
+
+    for (auto& c : chunks) {
+        assert(c);
+        addFunc(*c);
+    }
+
+    addFunc(tail);
+}
+
+void GuiAppMgr::clearRecvListEntries()
+{
+    m_recvListChunks.clear();
+    m_recvListTail = RecvListChunk();
+}
+
+GuiAppMgr::RecvListEntry GuiAppMgr::makeRecvListEntry(ToolsMessagePtr msg, MsgType type)
+{
+    assert(msg);
+    RecvListEntry entry;
+    entry.m_type = type;
+    entry.m_hasId = msg->hasId();
+    if (entry.m_hasId) {
+        entry.m_id = msg->numericId();
+        entry.m_name = msg->name();
+    }
+
+    entry.m_msg = std::move(msg);
+    return entry;
+}
+
 bool GuiAppMgr::canAddToRecvList(
-    const ToolsMessage& msg,
-    MsgType type) const
+    const RecvListEntry& entry,
+    unsigned mode,
+    const RecvListFilter& filter)
 {
+    auto type = entry.m_type;
     assert((type == MsgType::Received) || (type == MsgType::Sent));
 
-    if (msg.idAsString().isEmpty()) {
+    if (!entry.m_hasId) {
         assert(type == MsgType::Received);
-        return recvListShowsGarbage();
+        return (mode & RecvListMode_ShowGarbage) != 0U;
     }
 
-    if ((type == MsgType::Sent) && (!recvListShowsSent())) {
+    if ((type == MsgType::Sent) && ((mode & RecvListMode_ShowSent) == 0U)) {
         return false;
     }
 
-    if ((type == MsgType::Received) && (!recvListShowsReceived())) {
+    if ((type == MsgType::Received) && ((mode & RecvListMode_ShowReceived) == 0U)) {
         return false;
     }
 
-    if (!recvListApplyFilter()) {
+    if ((mode & RecvListMode_ApplyFilter) == 0U) {
         return true;
     }
 
-    auto desc = messageDesc(msg);
-    auto iter = std::lower_bound(m_filteredMessages.begin(), m_filteredMessages.end(), desc);
-    return (iter == m_filteredMessages.end()) || (*iter != desc);
+    auto id = entry.m_id;
+    if (filter.m_hiddenIds.find(id) != filter.m_hiddenIds.end()) {
+        return false;
+    }
+
+    if (!filter.m_hiddenVariants.empty()) {
+        auto variantsIter = filter.m_hiddenVariants.find(id);
+        if (variantsIter != filter.m_hiddenVariants.end()) {
+            auto& names = variantsIter->second;
+            if (std::find(names.begin(), names.end(), entry.m_name) != names.end()) {
+                return false;
+            }
+        }
+    }
+
+    return (!filter.m_query) || filter.m_query->matches(*entry.m_msg);
+}
+
+GuiAppMgr::MsgsIndex GuiAppMgr::buildRecvListIndex(
+    const RecvListSnapshot& entries,
+    unsigned mode,
+    const RecvListFilterPtr& filter,
+    const std::atomic<bool>& cancelled)
+{
+    assert(filter);
+    std::size_t threadsCount = std::max(1U, std::thread::hardware_concurrency());
+    auto chunksPerThread = std::max(std::size_t(1U), (entries.size() + threadsCount - 1U) / threadsCount);
+
+    // Every range of the chunks is filtered by a separate thread, the results
+    // are concatenated in order afterwards.
+    std::vector<std::future<MsgsIndex>> parts;
+    for (std::size_t from = 0U; from < entries.size(); from += chunksPerThread) {
+        auto to = std::min(entries.size(), from + chunksPerThread);
+        parts.push_back(
+            std::async(
+                std::launch::async,
+                [&entries, mode, &filter, &cancelled, from, to]()
+                {
+                    MsgsIndex result;
+                    for (auto idx = from; idx < to; ++idx) {
+                        assert(entries[idx]);
+                        for (auto& entry : *entries[idx]) {
+                            if (cancelled) {
+                                return result;
+                            }
+
+                            if (canAddToRecvList(entry, mode, *filter)) {
+                                result.push_back(entry.m_msg);
+                            }
+                        }
+                    }
+                    return result;
+                }));
+    }
+
+    MsgsIndex index;
+    for (auto& p : parts) {
+        auto partIndex = p.get();
+        index.insert(index.end(), std::make_move_iterator(partIndex.begin()), std::make_move_iterator(partIndex.end()));
+    }
+
+    return index;
+}
+
+void GuiAppMgr::updateRecvListFilter()
+{
+    auto filter = std::make_shared<RecvListFilter>();
+    filter->m_query = m_recvListQuery;
+    auto protocol = MsgMgrG::instanceRef().getProtocol();
+    if ((!m_filteredMessages.empty()) && protocol) {
+        assert(std::is_sorted(m_filteredMessages.begin(), m_filteredMessages.end()));
+
+        // The string descriptions are mapped to the numeric ids only once,
+        // when the filter or the protocol changes.
+        std::unordered_set<qlonglong> visibleIds;
+        RecvListFilter::HiddenVariants hiddenIds;
+        auto allMsgs = protocol->createAllMessages();
+        for (auto& msgPtr : allMsgs) {
+            assert(msgPtr);
+            auto id = msgPtr->numericId();
+            auto desc = messageDesc(*msgPtr);
+            if (!std::binary_search(m_filteredMessages.begin(), m_filteredMessages.end(), desc)) {
+                visibleIds.insert(id);
+                continue;
+            }
+
+            hiddenIds[id].push_back(msgPtr->name());
+        }
+
+        for (auto& info : hiddenIds) {
+            if (visibleIds.find(info.first) == visibleIds.end()) {
+                filter->m_hiddenIds.insert(info.first);
+                continue;
+            }
+
+            filter->m_hiddenVariants.insert(std::move(info));
+        }
+    }
+
+    // The previous filter object may still be used by the background
+    // rebuild of the receive list, hence a new one is always created.
+    m_recvListFilter = std::move(filter);
+}
+
+void GuiAppMgr::recvFind(bool forward)
+{
+    // Repeat the search kind that was updated last
+    if (m_recvFindData && m_recvDataPattern) {
+        recvFindData(forward);
+        return;
+    }
+
+    if (m_recvListQuery) {
+        emit sigRecvFindMsg(m_recvListQuery, forward);
+        return;
+    }
+
+    if (m_recvDataPattern) {
+        recvFindData(forward);
+    }
+}
+
+void GuiAppMgr::recvFindData(bool forward)
+{
+    assert(m_recvDataPattern);
+
+    // All the stored messages are searched, including the ones
+    // hidden from the receive list (e.g. garbage).
+    auto& allMsgs = MsgMgrG::instanceRef().getAllMsgs();
+    DataPattern::MsgsList msgs;
+    msgs.reserve(allMsgs.size());
+    int selectedIdx = -1;
+    for (auto& m : allMsgs) {
+        if ((m_selType == SelectionType::Recv) && (m == m_clickedMsg)) {
+            selectedIdx = static_cast<int>(msgs.size());
+        }
+
+        msgs.push_back(m.get());
+    }
+
+    if (msgs.empty()) {
+        return;
+    }
+
+    auto from = forward ? 0 : (static_cast<int>(msgs.size()) - 1);
+    if (0 <= selectedIdx) {
+        from = forward ? (selectedIdx + 1) : (selectedIdx - 1);
+    }
+
+    auto foundIdx = m_recvDataPattern->find(msgs, from, forward);
+    if (foundIdx < 0) {
+        return;
+    }
+
+    auto msg = *std::next(allMsgs.begin(), foundIdx);
+    assert(msg.get() == msgs[static_cast<std::size_t>(foundIdx)]);
+    m_recvFoundMsg.reset();
+    if (!revealInRecvList(msg)) {
+        m_recvFoundMsg = std::move(msg);
+        return;
+    }
+
+    emit sigRecvFoundData(std::move(msg), m_recvDataPattern);
+}
+
+bool GuiAppMgr::revealInRecvList(const ToolsMessagePtr& msg)
+{
+    assert(msg);
+    assert(m_recvListFilter);
+    auto type = static_cast<MsgType>(property::message::ToolsMsgType().getFrom(*msg));
+    auto entry = makeRecvListEntry(msg, type);
+    if (canAddToRecvList(entry, m_recvListMode, *m_recvListFilter)) {
+        // Will be displayed when the rebuild is complete
+        return !m_recvListRebuildInProgress;
+    }
+
+    // Enable display of the message kind, and if it's still hidden,
+    // stop applying the filter.
+    auto mode = m_recvListMode;
+    if (!entry.m_hasId) {
+        mode |= RecvListMode_ShowGarbage;
+    }
+    else if (type == MsgType::Sent) {
+        mode |= RecvListMode_ShowSent;
+    }
+    else {
+        mode |= RecvListMode_ShowReceived;
+    }
+
+    if (!canAddToRecvList(entry, mode, *m_recvListFilter)) {
+        mode &= static_cast<decltype(mode)>(~RecvListMode_ApplyFilter);
+    }
+
+    assert(canAddToRecvList(entry, mode, *m_recvListFilter));
+    m_recvListMode = mode;
+    emit sigRecvListModeUpdated();
+    emit sigRecvListTitleNeedsUpdate();
+    refreshRecvList();
+    return false;
 }
 
 void GuiAppMgr::decRecvListCount()
@@ -17,7 +17,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
+#include <list>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <QtCore/QObject>
 #include <QtCore/QString>
@@ -31,6 +38,8 @@
 
 #include "ActionWrap.h"
 #include "MsgMgrG.h"
+#include "DataPattern.h"
+#include "MsgQuery.h"
 
 namespace cc_tools_qt
 {
@@ -51,6 +60,7 @@ public:
         Idle,
         SendingSingle,
         SendingAll,
+        SendingBurst,
         NumOfStates
     };
 
@@ -65,6 +75,8 @@ public:
     using ActionPtr = std::shared_ptr<QAction>;
     using ListOfPluginInfos = ToolsPluginMgr::ListOfPluginInfos;
     using FilteredMessages = std::vector<QString>;
+    using MsgsIndex = std::vector<ToolsMessagePtr>;
+    using MsgsIndexPtr = std::shared_ptr<MsgsIndex>;
 
     enum class ActivityState
     {
@@ -103,6 +115,8 @@ public:
 
     void deleteMessages(ToolsMessagesList&& msgs);
     void sendMessages(ToolsMessagesList&& msgs);
+    ToolsMsgSendMgr::TimingStatsList sendTimingStats() const;
+    bool isSendPaused() const;
 
     static ActivityState getActivityState();
     bool applyNewPlugins(const ListOfPluginInfos& plugins);
@@ -111,6 +125,13 @@ public:
     const FilteredMessages& getFilteredMessages() const;
     void setFilteredMessages(FilteredMessages&& filteredMessages);
 
+    const MsgQuery::Ptr& getRecvListQuery() const;
+    void setRecvListQuery(MsgQuery::Ptr query);
+
+    const DataPattern::Ptr& getRecvDataPattern() const;
+    void setRecvDataPattern(DataPattern::Ptr pattern);
+    void recvDataMatchSelected(int offset, int length);
+
     static QString messageDesc(const ToolsMessage& msg);
 
     void setDebugOutputLevel(unsigned level);
@@ -131,9 +152,12 @@ public slots:
     void recvShowSentToggled(bool checked);
     void recvShowGarbageToggled(bool checked);
     void recvApplyFilterToggled(bool checked);
+    void recvFindNextClicked();
+    void recvFindPrevClicked();
 
     void sendStartClicked();
     void sendStartAllClicked();
+    void sendStartBurstClicked(unsigned count);
     void sendStopClicked();
     void sendLoadClicked();
     void sendSaveClicked();
@@ -162,6 +186,7 @@ public slots:
 
 signals:
     void sigAddRecvMsg(ToolsMessagePtr msg);
+    void sigRecvListReset(MsgsIndexPtr msgs);
     void sigAddSendMsg(ToolsMessagePtr msg);
     void sigSendMsgUpdated(ToolsMessagePtr msg);
     void sigSetRecvState(int state);
@@ -205,6 +230,10 @@ signals:
     void sigMsgCommentDialog(ToolsMessagePtr msg);
     void sigMsgCommentUpdated(ToolsMessagePtr msg);
     void sigRecvFilterDialog(ToolsProtocolPtr protocol);
+    void sigRecvFindMsg(MsgQuery::Ptr query, bool forward);
+    void sigRecvFoundData(ToolsMessagePtr msg, DataPattern::Ptr pattern);
+    void sigRecvListModeUpdated();
+    void sigDisplayDataHighlight(int offset, int length);
 
 private:
     enum class SelectionType
@@ -214,6 +243,40 @@ private:
         Send
     };
 
+    // Numeric representation of the FilteredMessages. The ids, all the
+    // message variants of which are hidden, are stored in m_hiddenIds.
+    // Only the ids shared by hidden and visible message variants
+    // require a comparison of the message names.
+    struct RecvListFilter
+    {
+        using HiddenIds = std::unordered_set<qlonglong>;
+        using HiddenNames = std::vector<std::string>;
+        using HiddenVariants = std::unordered_map<qlonglong, HiddenNames>;
+
+        HiddenIds m_hiddenIds;
+        HiddenVariants m_hiddenVariants;
+        MsgQuery::Ptr m_query;
+    };
+
+    using RecvListFilterPtr = std::shared_ptr<const RecvListFilter>;
+
+    // Captured by the GUI thread when the message is added, the message
+    // properties mustn't be accessed by the background threads.
+    struct RecvListEntry
+    {
+        ToolsMessagePtr m_msg;
+        MsgType m_type = MsgType::Invalid;
+        qlonglong m_id = 0;
+        const char* m_name = nullptr;
+        bool m_hasId = false;
+    };
+
+    // The entries of all the stored messages are kept in chunks. The filled
+    // chunks are immutable and shared with the background rebuilds.
+    using RecvListChunk = std::vector<RecvListEntry>;
+    using RecvListChunkPtr = std::shared_ptr<const RecvListChunk>;
+    using RecvListSnapshot = std::vector<RecvListChunkPtr>;
+
     GuiAppMgr(QObject* parentObj = nullptr);
     void emitRecvStateUpdate();
     void emitSendStateUpdate();
@@ -229,9 +292,20 @@ private /*data*/:
     void displayMessage(ToolsMessagePtr msg);
     void clearDisplayedMessage();
     void refreshRecvList();
+    void recvListIndexBuilt(unsigned generation, MsgsIndexPtr index);
+    void cancelRecvListRebuild();
     void addMsgToRecvList(ToolsMessagePtr msg);
     void clearRecvList(bool reportDeleted);
-    bool canAddToRecvList(const ToolsMessage& msg, MsgType type) const;
+    void addRecvListEntry(RecvListEntry&& entry);
+    void removeRecvListEntries(const ToolsMessagesList& msgs);
+    void clearRecvListEntries();
+    static RecvListEntry makeRecvListEntry(ToolsMessagePtr msg, MsgType type);
+    static bool canAddToRecvList(const RecvListEntry& entry, unsigned mode, const RecvListFilter& filter);
+    static MsgsIndex buildRecvListIndex(const RecvListSnapshot& entries, unsigned mode, const RecvListFilterPtr& filter, const std::atomic<bool>& cancelled);
+    void updateRecvListFilter();
+    void recvFind(bool forward);
+    void recvFindData(bool forward);
+    bool revealInRecvList(const ToolsMessagePtr& msg);
     void decRecvListCount();
     void decSendListCount();
     void emitRecvNotSelected();
@@ -250,6 +324,7 @@ private /*data*/:
 
     SendState m_sendState = SendState::Idle;
     unsigned m_sendListCount = 0;
+    unsigned m_sendBurstCount = 1U;
 
     SelectionType m_selType = SelectionType::None;
     ToolsMessagePtr m_clickedMsg;
@@ -261,6 +336,19 @@ private /*data*/:
     ToolsMsgSendMgr m_sendMgr;
 
     FilteredMessages m_filteredMessages;
+    MsgQuery::Ptr m_recvListQuery;
+    DataPattern::Ptr m_recvDataPattern;
+    bool m_recvFindData = false;
+    ToolsMessagePtr m_recvFoundMsg; ///< Selected when the rebuilt receive list is displayed
+    RecvListFilterPtr m_recvListFilter = std::make_shared<RecvListFilter>();
+
+    RecvListSnapshot m_recvListChunks; ///< Filled chunks
+    RecvListChunk m_recvListTail; ///< Chunk being filled
+    std::list<std::future<void>> m_recvListRebuilds; ///< Cancelled ones may still be running
+    std::shared_ptr<std::atomic<bool>> m_recvListRebuildCancelled;
+    MsgsIndex m_recvListRebuildPending;
+    unsigned m_recvListGeneration = 0U;
+    bool m_recvListRebuildInProgress = false;
 
     unsigned m_debugOutputLevel = 0U;
 };
@@ -268,3 +356,4 @@ private /*data*/:
 }  // namespace cc_tools_qt
 
 Q_DECLARE_METATYPE(cc_tools_qt::GuiAppMgr::ActionPtr);
+Q_DECLARE_METATYPE(cc_tools_qt::GuiAppMgr::MsgsIndexPtr);
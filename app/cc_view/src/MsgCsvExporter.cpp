@@ -0,0 +1,445 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgCsvExporter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QObject>
+#include <QtCore/QMetaObject>
+
+#include "cc_tools_qt/property/message.h"
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+using Kind = ToolsFieldDescriptor::Kind;
+
+const std::size_t WriteBufSize = 4U * 1024U * 1024U;
+const int ProgressReportPeriodMs = 200;
+
+struct MsgTypeInfo
+{
+    QString m_filename;
+    QString m_id;
+    QString m_name;
+    const ToolsFieldDescriptorsList* m_descriptors = nullptr;
+    std::vector<const ToolsMessage*> m_msgs;
+};
+
+using MsgTypesList = std::vector<MsgTypeInfo>;
+
+bool hasColumn(const ToolsFieldDescriptor& desc)
+{
+    // The values of the bundles and bitfields are reported by their members
+    return (desc.m_kind != Kind::Bundle) && (desc.m_kind != Kind::Bitfield);
+}
+
+void appendStr(std::string& buf, const QString& str)
+{
+    auto needsQuotes =
+        std::any_of(
+            str.begin(), str.end(),
+            [](QChar ch)
+            {
+                return (ch == ',') || (ch == '"') || (ch == '\n') || (ch == '\r');
+            });
+
+    if (!needsQuotes) {
+        buf.append(str.toStdString());
+        return;
+    }
+
+    auto escaped = str;
+    escaped.replace("\"", "\"\"");
+    buf.push_back('"');
+    buf.append(escaped.toStdString());
+    buf.push_back('"');
+}
+
+void appendValue(std::string& buf, const ToolsFieldDescriptor& desc, const ToolsMessage& msg)
+{
+    assert(desc.m_valueFunc != nullptr);
+    auto value = desc.m_valueFunc(msg);
+    if (!value.isValid()) {
+        return;
+    }
+
+    if (desc.m_kind == Kind::RawData) {
+        buf.append(value.toByteArray().toHex().toStdString());
+        return;
+    }
+
+    if (desc.m_kind == Kind::Float) {
+        buf.append(QString::number(value.toDouble(), 'g', 17).toStdString());
+        return;
+    }
+
+    appendStr(buf, value.toString());
+}
+
+const char* typeStr(const ToolsMessage& msg)
+{
+    auto type = static_cast<ToolsMessage::Type>(property::message::ToolsMsgType().getFrom(msg));
+    if (type == ToolsMessage::Type::Sent) {
+        return "sent";
+    }
+
+    return "received";
+}
+
+bool writeFileInternal(QFile& file, const MsgTypeInfo& info, std::atomic<unsigned long long>& done, const std::atomic<bool>& cancelled)
+{
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    assert(info.m_descriptors != nullptr);
+    auto& descriptors = *info.m_descriptors;
+
+    std::string buf;
+    buf.reserve(WriteBufSize + 4096U);
+    buf.append("timestamp,type,id,name");
+    for (auto& desc : descriptors) {
+        if (!hasColumn(desc)) {
+            continue;
+        }
+
+        buf.push_back(',');
+        appendStr(buf, desc.m_path);
+    }
+    buf.push_back('\n');
+
+    // Common for all the messages of the same type and ID
+    std::string idAndName;
+    appendStr(idAndName, info.m_id);
+    idAndName.push_back(',');
+    appendStr(idAndName, info.m_name);
+
+    unsigned long long written = 0U;
+    for (auto* msg : info.m_msgs) {
+        assert(msg != nullptr);
+        buf.append(std::to_string(property::message::ToolsMsgTimestamp().getFrom(*msg)));
+        buf.push_back(',');
+        buf.append(typeStr(*msg));
+        buf.push_back(',');
+        buf.append(idAndName);
+
+        for (auto& desc : descriptors) {
+            if (!hasColumn(desc)) {
+                continue;
+            }
+
+            buf.push_back(',');
+            appendValue(buf, desc, *msg);
+        }
+        buf.push_back('\n');
+        ++written;
+
+        if (buf.size() < WriteBufSize) {
+            continue;
+        }
+
+        if (cancelled) {
+            return false;
+        }
+
+        if (file.write(buf.data(), static_cast<qint64>(buf.size())) != static_cast<qint64>(buf.size())) {
+            return false;
+        }
+
+        buf.clear();
+        done += written;
+        written = 0U;
+    }
+
+    if (cancelled) {
+        return false;
+    }
+
+    done += written;
+    return file.write(buf.data(), static_cast<qint64>(buf.size())) == static_cast<qint64>(buf.size());
+}
+
+bool writeFile(const MsgTypeInfo& info, std::atomic<unsigned long long>& done, const std::atomic<bool>& cancelled)
+{
+    if (cancelled) {
+        return false;
+    }
+
+    QFile file(info.m_filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    if (writeFileInternal(file, info, done, cancelled)) {
+        return true;
+    }
+
+    file.close();
+    if (cancelled) {
+        // Partially written file is not left behind
+        file.remove();
+    }
+
+    return false;
+}
+
+QString typeFilename(const QFileInfo& baseInfo, const QString& msgName, std::set<QString>& usedNames)
+{
+    QString name;
+    for (auto ch : msgName) {
+        if (ch.isLetterOrNumber() || (ch == '_') || (ch == '-')) {
+            name.append(ch);
+            continue;
+        }
+
+        name.append('_');
+    }
+
+    auto uniqueName = name;
+    for (auto idx = 2; usedNames.find(uniqueName) != usedNames.end(); ++idx) {
+        uniqueName = name + QString("_%1").arg(idx);
+    }
+    usedNames.insert(uniqueName);
+
+    return baseInfo.dir().filePath(baseInfo.completeBaseName() + QChar('_') + uniqueName + ".csv");
+}
+
+MsgTypesList groupByType(
+    const QString& filename,
+    const MsgCsvExporter::MsgsList& msgs,
+    std::atomic<unsigned long long>& skipped,
+    const std::atomic<bool>& cancelled)
+{
+    // The messages of the same class may have different IDs
+    using TypeKey = std::pair<std::type_index, qlonglong>;
+
+    QFileInfo baseInfo(filename);
+    std::set<QString> usedNames;
+    std::map<TypeKey, std::size_t> typesMap;
+    MsgTypesList types;
+    for (auto& msgPtr : msgs) {
+        if (cancelled) {
+            break;
+        }
+
+        assert(msgPtr);
+        if (!msgPtr->hasId()) {
+            // Not recognised by the protocol
+            ++skipped;
+            continue;
+        }
+
+        TypeKey key(std::type_index(typeid(*msgPtr)), msgPtr->numericId());
+        auto iter = typesMap.find(key);
+        if (iter == typesMap.end()) {
+            MsgTypeInfo info;
+            info.m_name = msgPtr->name();
+            info.m_id = msgPtr->idAsString();
+            info.m_filename = typeFilename(baseInfo, info.m_name, usedNames);
+            info.m_descriptors = &msgPtr->fieldDescriptors();
+            iter = typesMap.emplace(key, types.size()).first;
+            types.push_back(std::move(info));
+        }
+
+        types[iter->second].m_msgs.push_back(msgPtr.get());
+    }
+
+    return types;
+}
+
+bool exportMsgs(
+    const QString& filename,
+    const MsgCsvExporter::MsgsList& msgs,
+    std::atomic<unsigned long long>& done,
+    const std::atomic<bool>& cancelled)
+{
+    auto types = groupByType(filename, msgs, done, cancelled);
+    if (types.empty()) {
+        return !cancelled;
+    }
+
+    auto threadsCount =
+        std::min(
+            types.size(),
+            static_cast<std::size_t>(std::max(1U, std::thread::hardware_concurrency())));
+
+    std::atomic<std::size_t> nextType(0U);
+    std::vector<std::future<bool>> workers;
+    workers.reserve(threadsCount);
+    for (auto idx = 0U; idx < threadsCount; ++idx) {
+        workers.push_back(
+            std::async(
+                std::launch::async,
+                [&types, &nextType, &done, &cancelled]()
+                {
+                    bool result = true;
+                    while (true) {
+                        auto typeIdx = nextType.fetch_add(1U);
+                        if (types.size() <= typeIdx) {
+                            break;
+                        }
+
+                        result = writeFile(types[typeIdx], done, cancelled) && result;
+                    }
+
+                    return result;
+                }));
+    }
+
+    bool result = true;
+    for (auto& w : workers) {
+        result = w.get() && result;
+    }
+
+    if (cancelled) {
+        // Files completed before the cancellation are removed as well
+        for (auto& t : types) {
+            QFile::remove(t.m_filename);
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+struct MsgCsvExporter::State
+{
+    QString m_filename;
+    MsgsList m_msgs;
+    std::atomic<unsigned long long> m_done{0U};
+    std::atomic<bool> m_cancelled{false};
+};
+
+MsgCsvExporter::MsgCsvExporter(QObject* parentObj) :
+    Base(parentObj)
+{
+    connect(
+        &m_progressTimer, &QTimer::timeout,
+        this, &MsgCsvExporter::reportProgress);
+}
+
+MsgCsvExporter::~MsgCsvExporter() noexcept
+{
+    if (!m_worker.valid()) {
+        return;
+    }
+
+    assert(m_state);
+    m_state->m_cancelled = true;
+    m_worker.wait();
+}
+
+const QString& MsgCsvExporter::getFilesFilter()
+{
+    static const QString Str(QObject::tr("CSV Files, per message type (*.csv)"));
+    return Str;
+}
+
+bool MsgCsvExporter::isCsvFile(const QString& filename)
+{
+    return filename.endsWith(".csv", Qt::CaseInsensitive);
+}
+
+void MsgCsvExporter::start(const QString& filename, MsgsList&& msgs)
+{
+    [[maybe_unused]] static constexpr bool The_previous_export_must_be_finished_first = false;
+    assert((!m_running) || The_previous_export_must_be_finished_first);
+
+    m_state = std::make_shared<State>();
+    m_state->m_filename = filename;
+    m_state->m_msgs = std::move(msgs);
+    m_total = static_cast<unsigned long long>(m_state->m_msgs.size());
+    m_running = true;
+
+    // The state is owned by this object, which waits for the worker
+    // before destruction, the messages are released by this thread.
+    m_worker =
+        std::async(
+            std::launch::async,
+            [this, state = m_state.get()]()
+            {
+                auto result = exportMsgs(state->m_filename, state->m_msgs, state->m_done, state->m_cancelled);
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, result]()
+                    {
+                        finished(result);
+                    },
+                    Qt::QueuedConnection);
+            });
+
+    m_progressTimer.start(ProgressReportPeriodMs);
+    reportProgress();
+}
+
+void MsgCsvExporter::cancel()
+{
+    if (!m_running) {
+        return;
+    }
+
+    assert(m_state);
+    m_state->m_cancelled = true;
+}
+
+void MsgCsvExporter::reportProgress()
+{
+    if (!m_state) {
+        return;
+    }
+
+    emit sigProgress(std::min(m_state->m_done.load(), m_total), m_total);
+}
+
+void MsgCsvExporter::finished(bool success)
+{
+    assert(m_worker.valid());
+    m_worker.get();
+    m_progressTimer.stop();
+    m_running = false;
+
+    assert(m_state);
+    bool cancelled = m_state->m_cancelled;
+    if (!cancelled) {
+        reportProgress();
+    }
+
+    m_state.reset();
+    emit sigFinished(success && (!cancelled), cancelled);
+}
+
+}  // namespace cc_tools_qt
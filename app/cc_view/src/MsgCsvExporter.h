@@ -0,0 +1,95 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+
+#include "cc_tools_qt/ToolsMessage.h"
+
+namespace cc_tools_qt
+{
+
+/// @brief Export of the decoded field values to CSV files.
+/// @details Every message type is written into a separate file, named
+///     "<base>_<MsgName>.csv", with a column per flattened payload field
+///     (see @ref ToolsMessage::fieldDescriptors()). The export is performed
+///     in the background, the message types are encoded in parallel.
+///     Messages that weren't recognised by the protocol are skipped.
+class MsgCsvExporter : public QObject
+{
+    Q_OBJECT
+    using Base = QObject;
+
+public:
+    using MsgsList = ToolsMessagesList;
+
+    explicit MsgCsvExporter(QObject* parentObj = nullptr);
+
+    /// @brief Destructor, cancels the export in progress and waits for it.
+    ~MsgCsvExporter() noexcept;
+
+    static const QString& getFilesFilter();
+
+    static bool isCsvFile(const QString& filename);
+
+    /// @brief Start the export.
+    /// @details The messages are kept until the export is finished.
+    ///     Reports the progress via sigProgress() and completion via
+    ///     sigFinished().
+    void start(const QString& filename, MsgsList&& msgs);
+
+    /// @brief Request cancellation of the export in progress.
+    /// @details The partially written files are removed, the completion
+    ///     is still reported via sigFinished().
+    void cancel();
+
+    bool isRunning() const
+    {
+        return m_running;
+    }
+
+signals:
+    /// @brief Number of the processed messages out of the total.
+    void sigProgress(unsigned long long done, unsigned long long total);
+
+    void sigFinished(bool success, bool cancelled);
+
+private slots:
+    void reportProgress();
+
+private:
+    struct State;
+    using StatePtr = std::shared_ptr<State>;
+
+    void finished(bool success);
+
+    StatePtr m_state;
+    std::future<void> m_worker;
+    QTimer m_progressTimer;
+    unsigned long long m_total = 0U;
+    bool m_running = false;
+};
+
+}  // namespace cc_tools_qt
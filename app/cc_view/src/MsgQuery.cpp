@@ -0,0 +1,906 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgQuery.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+#include <QtCore/QStringList>
+
+#include "cc_tools_qt/ToolsField.h"
+#include "cc_tools_qt/ToolsFieldHandler.h"
+#include "search.h"
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+struct Value
+{
+    enum class Kind
+    {
+        Invalid,
+        Number,
+        String
+    };
+
+    Kind m_kind = Kind::Invalid;
+    bool m_integral = false;
+    qlonglong m_int = 0;
+    double m_float = 0.0;
+    QString m_str; // String value or name of the numeric value (enum, id, special)
+
+    static Value fromInt(qlonglong val, const QString& name = QString())
+    {
+        Value result;
+        result.m_kind = Kind::Number;
+        result.m_integral = true;
+        result.m_int = val;
+        result.m_float = static_cast<double>(val);
+        result.m_str = name;
+        return result;
+    }
+
+    static Value fromFloat(double val)
+    {
+        Value result;
+        result.m_kind = Kind::Number;
+        result.m_float = val;
+        return result;
+    }
+
+    static Value fromString(const QString& val)
+    {
+        Value result;
+        result.m_kind = Kind::String;
+        result.m_str = val;
+        return result;
+    }
+
+    bool isValid() const
+    {
+        return m_kind != Kind::Invalid;
+    }
+
+    bool isTrue() const
+    {
+        if (m_kind == Kind::Number) {
+            if (m_integral) {
+                return m_int != 0;
+            }
+
+            return m_float != 0.0;
+        }
+
+        if (m_kind == Kind::String) {
+            return !m_str.isEmpty();
+        }
+
+        return false;
+    }
+
+    QString toString() const
+    {
+        if ((m_kind == Kind::String) || (!m_str.isEmpty())) {
+            return m_str;
+        }
+
+        if (m_integral) {
+            return QString::number(m_int);
+        }
+
+        return QString::number(m_float);
+    }
+};
+
+enum class CompOp
+{
+    Eq,
+    Ne,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+    Contains
+};
+
+template <typename T>
+int compareValues(const T& lhs, const T& rhs)
+{
+    if (lhs < rhs) {
+        return -1;
+    }
+
+    if (rhs < lhs) {
+        return 1;
+    }
+
+    return 0;
+}
+
+bool compare(const Value& lhs, CompOp op, const Value& rhs)
+{
+    if ((!lhs.isValid()) || (!rhs.isValid())) {
+        return false;
+    }
+
+    if (op == CompOp::Contains) {
+        return lhs.toString().contains(rhs.toString(), Qt::CaseInsensitive);
+    }
+
+    int result = 0;
+    if ((lhs.m_kind == Value::Kind::Number) && (rhs.m_kind == Value::Kind::Number)) {
+        if (lhs.m_integral && rhs.m_integral) {
+            result = compareValues(lhs.m_int, rhs.m_int);
+        }
+        else {
+            result = compareValues(lhs.m_float, rhs.m_float);
+        }
+    }
+    else {
+        result = QString::compare(lhs.toString(), rhs.toString(), Qt::CaseSensitive);
+    }
+
+    switch (op) {
+        case CompOp::Eq: return result == 0;
+        case CompOp::Ne: return result != 0;
+        case CompOp::Lt: return result < 0;
+        case CompOp::Le: return result <= 0;
+        case CompOp::Gt: return 0 < result;
+        case CompOp::Ge: return 0 <= result;
+        case CompOp::Contains: break;
+    }
+
+    [[maybe_unused]] static constexpr bool Unexpected_operation = false;
+    assert(Unexpected_operation);
+    return false;
+}
+
+// Field names are matched case insensitive ignoring the spaces to
+// allow their usage in the expression.
+bool nameMatches(const char* name, const QString& comp)
+{
+    assert(name != nullptr);
+    int idx = 0;
+    for (auto* ch = name; *ch != '\0'; ++ch) {
+        if (*ch == ' ') {
+            continue;
+        }
+
+        if ((comp.size() <= idx) || (QChar::fromLatin1(*ch).toLower() != comp[idx].toLower())) {
+            return false;
+        }
+
+        ++idx;
+    }
+
+    return idx == comp.size();
+}
+
+using Path = QStringList;
+using PathIter = Path::const_iterator;
+
+struct EvalContext
+{
+    explicit EvalContext(ToolsMessage& msg) : m_msg(msg) {}
+
+    ToolsMessage::FieldsList& fields()
+    {
+        if (!m_fields) {
+            // Shared with other evaluations and the display of the message
+            m_fields = m_msg.cachedPayloadFields();
+            assert(m_fields);
+        }
+
+        return *m_fields;
+    }
+
+    ToolsMessage& m_msg;
+
+private:
+    ToolsMessage::FieldsListPtr m_fields;
+};
+
+using BoolEvaluator = std::function<bool (EvalContext& ctx)>;
+using ValueEvaluator = std::function<Value (EvalContext& ctx)>;
+
+class PathEvaluator : public ToolsFieldHandler
+{
+public:
+    PathEvaluator(PathIter begin, PathIter end) :
+        m_begin(begin),
+        m_end(end)
+    {
+    }
+
+    const Value& value() const
+    {
+        return m_value;
+    }
+
+    virtual void handle(field::ToolsArrayListField& field) override
+    {
+        if (atEnd()) {
+            m_value = Value::fromInt(static_cast<qlonglong>(field.size()));
+            return;
+        }
+
+        bool ok = false;
+        auto idx = m_begin->toInt(&ok);
+        auto& members = field.getMembers();
+        if ((!ok) || (idx < 0) || (static_cast<int>(members.size()) <= idx)) {
+            return;
+        }
+
+        auto& mem = members[static_cast<std::size_t>(idx)];
+        assert(mem);
+        descend(*mem);
+    }
+
+    virtual void handle(field::ToolsBitfieldField& field) override
+    {
+        handleMembers(field.getMembers());
+    }
+
+    virtual void handle(field::ToolsBitmaskField& field) override
+    {
+        if (atEnd()) {
+            m_value = Value::fromInt(static_cast<qlonglong>(field.getValue()));
+            return;
+        }
+
+        if (std::next(m_begin) != m_end) {
+            return;
+        }
+
+        auto& bits = field.bits();
+        for (auto idx = 0; idx < bits.size(); ++idx) {
+            if (nameMatches(bits[idx].toLatin1().constData(), *m_begin)) {
+                m_value = Value::fromInt(field.bitValue(static_cast<unsigned>(idx)) ? 1 : 0);
+                return;
+            }
+        }
+    }
+
+    virtual void handle(field::ToolsBundleField& field) override
+    {
+        handleMembers(field.getMembers());
+    }
+
+    virtual void handle(field::ToolsEnumField& field) override
+    {
+        if (!atEnd()) {
+            return;
+        }
+
+        auto val = field.getValue();
+        QString name;
+        auto& values = field.values();
+        auto iter =
+            std::find_if(
+                values.begin(), values.end(),
+                [val](auto& info)
+                {
+                    return info.second == val;
+                });
+
+        if (iter != values.end()) {
+            name = iter->first;
+        }
+
+        m_value = Value::fromInt(val, name);
+    }
+
+    virtual void handle(field::ToolsFloatField& field) override
+    {
+        if (!atEnd()) {
+            return;
+        }
+
+        m_value = Value::fromFloat(field.getValue());
+    }
+
+    virtual void handle(field::ToolsIntField& field) override
+    {
+        if (!atEnd()) {
+            return;
+        }
+
+        if (field.hasScaledDecimals()) {
+            m_value = Value::fromFloat(field.getScaled());
+            return;
+        }
+
+        auto val = field.getDisplayValue();
+        m_value = Value::fromInt(val, specialName(field.specials(), field.getValue()));
+    }
+
+    virtual void handle(field::ToolsOptionalField& field) override
+    {
+        if ((field.getMode() != field::ToolsOptionalField::Mode::Exists) || (!field.hasField())) {
+            return;
+        }
+
+        // Optional wrapping is transparent to the path
+        field.getField().dispatch(*this);
+    }
+
+    virtual void handle(field::ToolsRawDataField& field) override
+    {
+        if (!atEnd()) {
+            return;
+        }
+
+        m_value = Value::fromString(field.getFullValue());
+    }
+
+    virtual void handle(field::ToolsStringField& field) override
+    {
+        if (!atEnd()) {
+            return;
+        }
+
+        m_value = Value::fromString(field.getValue());
+    }
+
+    virtual void handle(field::ToolsUnknownField& field) override
+    {
+        if (!atEnd()) {
+            return;
+        }
+
+        m_value = Value::fromString(field.getSerialisedString());
+    }
+
+    virtual void handle(field::ToolsUnsignedLongField& field) override
+    {
+        if (!atEnd()) {
+            return;
+        }
+
+        if (field.hasScaledDecimals()) {
+            m_value = Value::fromFloat(field.getScaled());
+            return;
+        }
+
+        auto val = field.getDisplayValue();
+        m_value = Value::fromInt(static_cast<qlonglong>(val), specialName(field.specials(), field.getValue()));
+    }
+
+    virtual void handle(field::ToolsVariantField& field) override
+    {
+        auto* current = field.getCurrent();
+        if (current == nullptr) {
+            return;
+        }
+
+        if ((!atEnd()) && nameMatches(current->name(), *m_begin)) {
+            descend(*current);
+            return;
+        }
+
+        // Allow omitting the name of the current variant member
+        current->dispatch(*this);
+    }
+
+    virtual void handle([[maybe_unused]] ToolsField& field) override
+    {
+    }
+
+private:
+    bool atEnd() const
+    {
+        return m_begin == m_end;
+    }
+
+    void descend(ToolsField& member)
+    {
+        PathEvaluator nested(std::next(m_begin), m_end);
+        member.dispatch(nested);
+        m_value = nested.value();
+    }
+
+    void handleMembers(ToolsField::Members& members)
+    {
+        if (atEnd()) {
+            return;
+        }
+
+        for (auto& mem : members) {
+            assert(mem);
+            if (nameMatches(mem->name(), *m_begin)) {
+                descend(*mem);
+                return;
+            }
+        }
+    }
+
+    template <typename TSpecials, typename TValue>
+    static QString specialName(const TSpecials& specials, TValue val)
+    {
+        for (auto& s : specials) {
+            if (s.second == val) {
+                return s.first;
+            }
+        }
+
+        return QString();
+    }
+
+    PathIter m_begin;
+    PathIter m_end;
+    Value m_value;
+};
+
+Value evalPath(EvalContext& ctx, const Path& path)
+{
+    assert(!path.isEmpty());
+    auto begin = path.begin();
+    if ((1 < path.size()) && nameMatches(ctx.m_msg.name(), *begin)) {
+        ++begin;
+    }
+
+    for (auto& f : ctx.fields()) {
+        assert(f);
+        if (nameMatches(f->name(), *begin)) {
+            PathEvaluator evaluator(std::next(begin), path.end());
+            f->dispatch(evaluator);
+            return evaluator.value();
+        }
+    }
+
+    return Value();
+}
+
+class Parser
+{
+public:
+    explicit Parser(const QString& expr) : m_expr(expr) {}
+
+    BoolEvaluator parse(QString& error)
+    {
+        nextToken();
+        auto result = parseOr();
+        if (m_error.isEmpty() && (m_token.m_type != TokenType::End)) {
+            setError("Unexpected \"" + m_token.m_str + "\"");
+        }
+
+        if (!m_error.isEmpty()) {
+            error = m_error;
+            return BoolEvaluator();
+        }
+
+        return result;
+    }
+
+private:
+    enum class TokenType
+    {
+        End,
+        Ident,
+        Number,
+        String,
+        Comp,
+        And,
+        Or,
+        Not,
+        LParen,
+        RParen,
+        Invalid
+    };
+
+    struct Token
+    {
+        TokenType m_type = TokenType::End;
+        QString m_str;
+        int m_pos = 0;
+    };
+
+    static bool isIdentChar(QChar ch)
+    {
+        return
+            ch.isLetterOrNumber() ||
+            (ch == '_') ||
+            (ch == '.') ||
+            (ch == '[') ||
+            (ch == ']');
+    }
+
+    void nextToken()
+    {
+        while ((m_pos < m_expr.size()) && m_expr[m_pos].isSpace()) {
+            ++m_pos;
+        }
+
+        m_token = Token();
+        m_token.m_pos = m_pos;
+        if (m_expr.size() <= m_pos) {
+            return;
+        }
+
+        auto ch = m_expr[m_pos];
+        auto nextCh = QChar();
+        if ((m_pos + 1) < m_expr.size()) {
+            nextCh = m_expr[m_pos + 1];
+        }
+
+        auto twoCharToken =
+            [this](TokenType type)
+            {
+                m_token.m_type = type;
+                m_token.m_str = m_expr.mid(m_pos, 2);
+                m_pos += 2;
+            };
+
+        auto singleCharToken =
+            [this](TokenType type)
+            {
+                m_token.m_type = type;
+                m_token.m_str = m_expr.mid(m_pos, 1);
+                ++m_pos;
+            };
+
+        if ((ch == '&') && (nextCh == '&')) {
+            twoCharToken(TokenType::And);
+            return;
+        }
+
+        if ((ch == '|') && (nextCh == '|')) {
+            twoCharToken(TokenType::Or);
+            return;
+        }
+
+        if (((ch == '=') || (ch == '!') || (ch == '<') || (ch == '>') || (ch == '~')) && (nextCh == '=')) {
+            twoCharToken(TokenType::Comp);
+            return;
+        }
+
+        if ((ch == '<') || (ch == '>')) {
+            singleCharToken(TokenType::Comp);
+            return;
+        }
+
+        if (ch == '!') {
+            singleCharToken(TokenType::Not);
+            return;
+        }
+
+        if (ch == '(') {
+            singleCharToken(TokenType::LParen);
+            return;
+        }
+
+        if (ch == ')') {
+            singleCharToken(TokenType::RParen);
+            return;
+        }
+
+        if (ch == '"') {
+            ++m_pos;
+            m_token.m_type = TokenType::String;
+            while (m_pos < m_expr.size()) {
+                auto strCh = m_expr[m_pos];
+                ++m_pos;
+                if (strCh == '"') {
+                    return;
+                }
+
+                if ((strCh == '\\') && (m_pos < m_expr.size())) {
+                    strCh = m_expr[m_pos];
+                    ++m_pos;
+                }
+
+                m_token.m_str.append(strCh);
+            }
+
+            setError("Unterminated string");
+            m_token.m_type = TokenType::Invalid;
+            return;
+        }
+
+        if (ch.isDigit() || (((ch == '-') || (ch == '+') || (ch == '.')) && nextCh.isDigit())) {
+            m_token.m_type = TokenType::Number;
+            m_token.m_str.append(ch);
+            ++m_pos;
+            while ((m_pos < m_expr.size()) && (m_expr[m_pos].isLetterOrNumber() || (m_expr[m_pos] == '.'))) {
+                m_token.m_str.append(m_expr[m_pos]);
+                ++m_pos;
+            }
+            return;
+        }
+
+        if (isIdentChar(ch)) {
+            m_token.m_type = TokenType::Ident;
+            while ((m_pos < m_expr.size()) && isIdentChar(m_expr[m_pos])) {
+                m_token.m_str.append(m_expr[m_pos]);
+                ++m_pos;
+            }
+            return;
+        }
+
+        m_token.m_type = TokenType::Invalid;
+        m_token.m_str = ch;
+        setError("Unexpected \"" + m_token.m_str + "\"");
+    }
+
+    void setError(const QString& msg)
+    {
+        if (!m_error.isEmpty()) {
+            return;
+        }
+
+        m_error = QString("%1 at position %2").arg(msg).arg(m_token.m_pos + 1);
+    }
+
+    BoolEvaluator parseOr()
+    {
+        auto lhs = parseAnd();
+        while (m_error.isEmpty() && (m_token.m_type == TokenType::Or)) {
+            nextToken();
+            auto rhs = parseAnd();
+            lhs =
+                [first = std::move(lhs), second = std::move(rhs)](EvalContext& ctx)
+                {
+                    return first(ctx) || second(ctx);
+                };
+        }
+        return lhs;
+    }
+
+    BoolEvaluator parseAnd()
+    {
+        auto lhs = parseUnary();
+        while (m_error.isEmpty() && (m_token.m_type == TokenType::And)) {
+            nextToken();
+            auto rhs = parseUnary();
+            lhs =
+                [first = std::move(lhs), second = std::move(rhs)](EvalContext& ctx)
+                {
+                    return first(ctx) && second(ctx);
+                };
+        }
+        return lhs;
+    }
+
+    BoolEvaluator parseUnary()
+    {
+        if (m_token.m_type == TokenType::Not) {
+            nextToken();
+            auto operand = parseUnary();
+            return
+                [inner = std::move(operand)](EvalContext& ctx)
+                {
+                    return !inner(ctx);
+                };
+        }
+
+        if (m_token.m_type == TokenType::LParen) {
+            nextToken();
+            auto result = parseOr();
+            if (m_token.m_type != TokenType::RParen) {
+                setError("Missing \")\"");
+                return BoolEvaluator();
+            }
+
+            nextToken();
+            return result;
+        }
+
+        return parseComparison();
+    }
+
+    BoolEvaluator parseComparison()
+    {
+        auto lhs = parseOperand();
+        if (!m_error.isEmpty()) {
+            return BoolEvaluator();
+        }
+
+        if (m_token.m_type != TokenType::Comp) {
+            return
+                [lhs = std::move(lhs)](EvalContext& ctx)
+                {
+                    return lhs(ctx).isTrue();
+                };
+        }
+
+        auto op = compOp(m_token.m_str);
+        nextToken();
+        auto rhs = parseOperand();
+        if (!m_error.isEmpty()) {
+            return BoolEvaluator();
+        }
+
+        return
+            [first = std::move(lhs), op, second = std::move(rhs)](EvalContext& ctx)
+            {
+                return compare(first(ctx), op, second(ctx));
+            };
+    }
+
+    ValueEvaluator parseOperand()
+    {
+        auto token = m_token;
+        if (token.m_type == TokenType::String) {
+            nextToken();
+            return constValue(Value::fromString(token.m_str));
+        }
+
+        if (token.m_type == TokenType::Number) {
+            nextToken();
+            return parseNumber(token.m_str);
+        }
+
+        if (token.m_type == TokenType::Ident) {
+            nextToken();
+            return parseIdent(token.m_str);
+        }
+
+        if (token.m_type == TokenType::End) {
+            setError("Unexpected end of expression");
+        }
+        else {
+            setError("Unexpected \"" + token.m_str + "\"");
+        }
+
+        return ValueEvaluator();
+    }
+
+    ValueEvaluator parseNumber(const QString& str)
+    {
+        bool ok = false;
+        auto intVal = str.toLongLong(&ok, 0);
+        if (ok) {
+            return constValue(Value::fromInt(intVal));
+        }
+
+        auto floatVal = str.toDouble(&ok);
+        if (ok) {
+            return constValue(Value::fromFloat(floatVal));
+        }
+
+        setError("Invalid number \"" + str + "\"");
+        return ValueEvaluator();
+    }
+
+    ValueEvaluator parseIdent(const QString& str)
+    {
+        static const QString NameStr("name");
+        static const QString IdStr("id");
+
+        if (str == NameStr) {
+            return
+                [](EvalContext& ctx)
+                {
+                    return Value::fromString(QString(ctx.m_msg.name()));
+                };
+        }
+
+        if (str == IdStr) {
+            return
+                [](EvalContext& ctx)
+                {
+                    return Value::fromInt(ctx.m_msg.numericId(), ctx.m_msg.idAsString());
+                };
+        }
+
+        auto normalised = str;
+        normalised.replace('[', '.');
+        normalised.remove(']');
+        auto path = normalised.split('.');
+        path.removeAll(QString());
+        if (path.isEmpty()) {
+            setError("Invalid field path \"" + str + "\"");
+            return ValueEvaluator();
+        }
+
+        return
+            [fieldPath = std::move(path)](EvalContext& ctx)
+            {
+                return evalPath(ctx, fieldPath);
+            };
+    }
+
+    static ValueEvaluator constValue(Value&& val)
+    {
+        return
+            [constVal = std::move(val)]([[maybe_unused]] EvalContext& ctx)
+            {
+                return constVal;
+            };
+    }
+
+    static CompOp compOp(const QString& str)
+    {
+        static const std::pair<const char*, CompOp> Map[] = {
+            {"==", CompOp::Eq},
+            {"!=", CompOp::Ne},
+            {"<=", CompOp::Le},
+            {">=", CompOp::Ge},
+            {"<", CompOp::Lt},
+            {">", CompOp::Gt},
+            {"~=", CompOp::Contains},
+        };
+
+        for (auto& info : Map) {
+            if (str == info.first) {
+                return info.second;
+            }
+        }
+
+        [[maybe_unused]] static constexpr bool Unexpected_operation = false;
+        assert(Unexpected_operation);
+        return CompOp::Eq;
+    }
+
+    const QString& m_expr;
+    int m_pos = 0;
+    Token m_token;
+    QString m_error;
+};
+
+}  // namespace
+
+MsgQuery::~MsgQuery() noexcept = default;
+
+MsgQuery::Ptr MsgQuery::compile(const QString& expr, QString& error)
+{
+    Parser parser(expr);
+    auto evaluator = parser.parse(error);
+    if (!evaluator) {
+        return Ptr();
+    }
+
+    EvalFunc func =
+        [eval = std::move(evaluator)](ToolsMessage& msg)
+        {
+            EvalContext ctx(msg);
+            return eval(ctx);
+        };
+
+    return Ptr(new MsgQuery(expr.trimmed(), std::move(func)));
+}
+
+bool MsgQuery::matches(ToolsMessage& msg) const
+{
+    assert(m_func);
+    return m_func(msg);
+}
+
+int MsgQuery::find(const MsgsList& msgs, int from, bool forward) const
+{
+    return
+        search::findMsg(
+            msgs, from, forward,
+            [this](ToolsMessage& msg)
+            {
+                return matches(msg);
+            });
+}
+
+MsgQuery::MsgQuery(const QString& expr, EvalFunc&& func) :
+    m_expr(expr),
+    m_func(std::move(func))
+{
+}
+
+}  // namespace cc_tools_qt
@@ -0,0 +1,73 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QMetaType>
+#include <QtCore/QString>
+
+#include "cc_tools_qt/ToolsMessage.h"
+
+namespace cc_tools_qt
+{
+
+/// @brief Query on the decoded contents of the messages.
+/// @details The expression is compiled once into a tree of evaluators,
+///     which can be invoked concurrently from multiple threads.
+///     Supported syntax:
+///     @li Field path: "field", "Msg.field.member", "list[2].member", "mask.bit"
+///     @li Message properties: "name", "id"
+///     @li Literals: 10, -5, 0x1f, 1.5, "string"
+///     @li Comparison: ==, !=, <, <=, >, >=, ~= (contains, case insensitive)
+///     @li Logical: &&, ||, !, (...)
+class MsgQuery
+{
+public:
+    using Ptr = std::shared_ptr<const MsgQuery>;
+    using MsgsList = std::vector<ToolsMessagePtr>;
+    using EvalFunc = std::function<bool (ToolsMessage& msg)>;
+
+    ~MsgQuery() noexcept;
+
+    static Ptr compile(const QString& expr, QString& error);
+
+    const QString& expression() const
+    {
+        return m_expr;
+    }
+
+    bool matches(ToolsMessage& msg) const;
+
+    /// @brief Find the first matching message starting from (and including)
+    ///     the provided position.
+    /// @return Index of the found message, -1 if not found.
+    int find(const MsgsList& msgs, int from, bool forward) const;
+
+private:
+    MsgQuery(const QString& expr, EvalFunc&& func);
+
+    QString m_expr;
+    EvalFunc m_func;
+};
+
+}  // namespace cc_tools_qt
+
+Q_DECLARE_METATYPE(cc_tools_qt::MsgQuery::Ptr);
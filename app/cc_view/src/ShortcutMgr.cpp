@@ -94,6 +94,8 @@ void ShortcutMgr::createInitialMap()
         /* Key_SaveRecv */ "Ctrl+V,R",
         /* Key_Receive */ "F5",
         /* Key_EditFilter */ "Ctrl+Shift+F",
+        /* Key_FindNext */ "F3",
+        /* Key_FindPrev */ "Shift+F3",
     };
 
     static const std::size_t KeysSize = std::extent<decltype(Keys)>::value;
@@ -59,6 +59,8 @@ public:
         Key_SaveRecv,
         Key_Receive,
         Key_EditFilter,
+        Key_FindNext,
+        Key_FindPrev,
         Key_NumOfValues // Must be last
     };
 
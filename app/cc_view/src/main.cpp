@@ -37,6 +37,7 @@ const QString CleanOptStr("clean");
 const QString ConfigOptStr("config");
 const QString PluginsOptStr("plugins");
 const QString DebugOptStr("debug");
+const QString PipelinedFiltersOptStr("pipelined-filters");
 
 void metaTypesRegisterAll()
 {
@@ -82,6 +83,12 @@ void prepareCommandLineOptions(QCommandLineParser& parser)
         "0"
     );
     parser.addOption(debugOpt);
+
+    QCommandLineOption pipelinedFiltersOpt(
+        PipelinedFiltersOptStr,
+        QCoreApplication::translate("main", "Run every filter of the received data, which supports it, on its own thread.")
+    );
+    parser.addOption(pipelinedFiltersOpt);
 }
 
 }  // namespace
@@ -113,6 +120,7 @@ int main(int argc, char *argv[])
 
     auto& guiAppMgr = cc_tools_qt::GuiAppMgr::instanceRef();
     guiAppMgr.setDebugOutputLevel(parser.value(DebugOptStr).toUInt());
+    cc_tools_qt::MsgMgrG::instanceRef().setFilterPipelineEnabled(parser.isSet(PipelinedFiltersOptStr));
     do {
         if (parser.isSet(CleanOptStr) && guiAppMgr.startClean()) {
             break;
@@ -0,0 +1,94 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "cc_tools_qt/ToolsMessage.h"
+
+namespace cc_tools_qt
+{
+
+namespace search
+{
+
+/// @brief Find the first message matching the predicate starting from
+///     (and including) the provided position.
+/// @details The search range is split into chunks processed in parallel in rounds,
+///     where the next round is started only if none of the chunks of the
+///     current one reports a match to avoid scanning the whole list when
+///     the match is nearby. The predicate is invoked concurrently.
+///     The list is expected to be a random access container of
+///     the message pointers (smart or raw).
+/// @return Index of the found message, -1 if not found.
+template <typename TMsgsList, typename TFunc>
+int findMsg(const TMsgsList& msgs, int from, bool forward, TFunc&& func)
+{
+    auto total = static_cast<int>(msgs.size());
+    if ((from < 0) || (total <= from)) {
+        return -1;
+    }
+
+    static const int MinChunkSize = 4 * 1024;
+    int threadsCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int remaining = forward ? (total - from) : (from + 1);
+    int pos = from;
+    int step = forward ? 1 : -1;
+
+    while (0 < remaining) {
+        std::vector<std::future<int>> chunks;
+        for (auto idx = 0; (idx < threadsCount) && (0 < remaining); ++idx) {
+            auto count = std::min(remaining, MinChunkSize);
+            chunks.push_back(
+                std::async(
+                    std::launch::async,
+                    [&msgs, &func, begin = pos, count, step]()
+                    {
+                        auto msgIdx = begin;
+                        for (auto processed = 0; processed < count; ++processed, msgIdx += step) {
+                            auto& msgPtr = msgs[static_cast<std::size_t>(msgIdx)];
+                            if (msgPtr && func(*msgPtr)) {
+                                return msgIdx;
+                            }
+                        }
+
+                        return -1;
+                    }));
+
+            pos += count * step;
+            remaining -= count;
+        }
+
+        for (auto& c : chunks) {
+            auto result = c.get();
+            if (0 <= result) {
+                return result;
+            }
+        }
+    }
+
+    return -1;
+}
+
+} // namespace search
+
+} // namespace cc_tools_qt
@@ -85,6 +85,16 @@ void DefaultMessageDisplayWidget::refreshImpl()
     }
 }
 
+void DefaultMessageDisplayWidget::highlightDataImpl(int offset, int length)
+{
+    // Selection of the raw data displays it in the details widget
+    if (!m_protocolsDetailsWidget->selectRawData()) {
+        return;
+    }
+
+    m_msgDetailsWidget->highlightData(offset, length);
+}
+
 void DefaultMessageDisplayWidget::msgSelectedInProtocol(
     ToolsMessagePtr msg,
     bool editEnabled)
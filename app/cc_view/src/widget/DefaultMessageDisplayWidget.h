@@ -36,6 +36,7 @@ protected:
     virtual void setEditEnabledImpl(bool enabled) override;
     virtual void clearImpl() override;
     virtual void refreshImpl() override;
+    virtual void highlightDataImpl(int offset, int length) override;
 
 private slots:
     void msgSelectedInProtocol(ToolsMessagePtr msg, bool editEnabled);
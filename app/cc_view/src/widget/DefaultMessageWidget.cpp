@@ -31,7 +31,7 @@ DefaultMessageWidget::DefaultMessageWidget(
     ToolsMessage& msg,
     QWidget* parentObj)
   : Base(parentObj),
-    m_msg(msg),
+    m_msg(&msg),
     m_layout(new LayoutType())
 {
     setLayout(m_layout);
@@ -53,6 +53,7 @@ void DefaultMessageWidget::addExtraTransportFieldWidget(FieldWidget* field)
     }
     m_layout->insertWidget(m_layout->count() - 1, field);
     connectFieldSignals(field);
+    m_transportFieldWidgets.push_back(field);
 
     ++m_curExtraTransportFieldIdx;
 }
@@ -70,10 +71,46 @@ void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
     }
     m_layout->insertWidget(m_layout->count() - 1, field);
     connectFieldSignals(field);
+    m_fieldWidgets.push_back(field);
 
     ++m_curFieldIdx;
 }
 
+bool DefaultMessageWidget::rebind(
+    ToolsMessage& msg,
+    const ToolsMessage::FieldsListPtr& transportFields,
+    const ToolsMessage::FieldsListPtr& payloadFields)
+{
+    auto rebindFunc =
+        [](std::vector<FieldWidget*>& widgets, const ToolsMessage::FieldsListPtr& fieldsPtr)
+        {
+            assert(fieldsPtr);
+            auto& fields = *fieldsPtr;
+            if (widgets.size() != fields.size()) {
+                return false;
+            }
+
+            for (auto idx = 0U; idx < widgets.size(); ++idx) {
+                assert(fields[idx]);
+                // The wrapper stays valid as long as the list is alive
+                FieldWidget::SharedFieldPtr fieldPtr(fieldsPtr, fields[idx].get());
+                if (!widgets[idx]->rebind(fieldPtr)) {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+    if ((!rebindFunc(m_transportFieldWidgets, transportFields)) ||
+        (!rebindFunc(m_fieldWidgets, payloadFields))) {
+        return false;
+    }
+
+    m_msg = &msg;
+    return true;
+}
+
 void DefaultMessageWidget::refreshImpl()
 {
     emit sigRefreshFields();
@@ -84,6 +121,11 @@ void DefaultMessageWidget::setEditEnabledImpl(bool enabled)
     emit sigSetEditEnabled(enabled);
 }
 
+void DefaultMessageWidget::highlightDataImpl(int offset, int length)
+{
+    emit sigHighlightData(offset, length);
+}
+
 std::unique_ptr<QFrame> DefaultMessageWidget::createFieldSeparator()
 {
     std::unique_ptr<QFrame> line(new QFrame(this));
@@ -97,7 +139,17 @@ void DefaultMessageWidget::connectFieldSignals(FieldWidget* fieldWidget)
     assert(fieldWidget != nullptr);
     connect(this, &DefaultMessageWidget::sigRefreshFields, fieldWidget, &FieldWidget::refresh);
     connect(this, &DefaultMessageWidget::sigSetEditEnabled, fieldWidget, &FieldWidget::setEditEnabled);
-    connect(fieldWidget, &FieldWidget::sigFieldUpdated, this, &DefaultMessageWidget::sigMsgUpdated);
+    connect(this, &DefaultMessageWidget::sigHighlightData, fieldWidget, &FieldWidget::highlightData);
+    connect(fieldWidget, &FieldWidget::sigFieldUpdated, this, &DefaultMessageWidget::fieldUpdated);
+}
+
+void DefaultMessageWidget::fieldUpdated()
+{
+    // The edit could change the structure of the fields (list size, variant member),
+    // the previously created wrappers of the message cannot be reused.
+    assert(m_msg != nullptr);
+    m_msg->invalidateFields();
+    emit sigMsgUpdated();
 }
 
 }  // namespace cc_tools_qt
@@ -26,6 +26,7 @@
 #include <QtWidgets/QVBoxLayout>
 
 #include <memory>
+#include <vector>
 
 namespace cc_tools_qt
 {
@@ -41,21 +42,39 @@ public:
     void addExtraTransportFieldWidget(FieldWidget* field);
     void addFieldWidget(FieldWidget* field);
 
+    /// @brief Bind the existing field widgets to the fields of another
+    ///     message object of the same type.
+    /// @details The provided wrappers are expected to be the ones reported by
+    ///     the cachedTransportFields() and cachedPayloadFields() of the message.
+    ///     The field widgets share them instead of making own copies.
+    /// @return @b false if the widget cannot be reused and needs to be recreated.
+    bool rebind(
+        ToolsMessage& msg,
+        const ToolsMessage::FieldsListPtr& transportFields,
+        const ToolsMessage::FieldsListPtr& payloadFields);
+
 protected:
     virtual void refreshImpl() override;
     virtual void setEditEnabledImpl(bool enabled) override;
+    virtual void highlightDataImpl(int offset, int length) override;
 
 signals:
     void sigRefreshFields();
     void sigSetEditEnabled(bool enabled);
+    void sigHighlightData(int offset, int length);
+
+private slots:
+    void fieldUpdated();
 
 private:
     std::unique_ptr<QFrame> createFieldSeparator();
     void connectFieldSignals(FieldWidget* field);
 
     using LayoutType = QVBoxLayout;
-    ToolsMessage& m_msg;
+    ToolsMessage* m_msg = nullptr;
     LayoutType* m_layout;
+    std::vector<FieldWidget*> m_transportFieldWidgets;
+    std::vector<FieldWidget*> m_fieldWidgets;
     uint m_curExtraTransportFieldIdx = 0;
     uint m_curFieldIdx = 0;
 };
@@ -23,7 +23,9 @@
 #include "MessagesFilterDialog.h"
 #include "MessageUpdateDialog.h"
 #include "MsgCommentDialog.h"
+#include "MsgCsvExporter.h"
 #include "MsgFileMgrG.h"
+#include "MsgStatsDockWidget.h"
 #include "PluginConfigDialog.h"
 #include "RawHexDataDialog.h"
 #include "RightPaneWidget.h"
@@ -35,6 +37,8 @@
 #include <QtGui/QIcon>
 #include <QtGui/QKeySequence>
 #include <QtWidgets/QFileDialog>
+#include <QtWidgets/QMenu>
+#include <QtWidgets/QMenuBar>
 #include <QtWidgets/QMessageBox>
 #include <QtWidgets/QSplitter>
 
@@ -61,6 +65,14 @@ MainWindowWidget::MainWindowWidget(QWidget* parentObj)
     splitter->setStretchFactor(1, 1);
     setCentralWidget(splitter);
 
+    auto* statsDock = new MsgStatsDockWidget(this);
+    addDockWidget(Qt::BottomDockWidgetArea, statsDock);
+    statsDock->hide();
+
+    auto* viewMenu = new QMenu(tr("View"), m_ui.menubar);
+    viewMenu->addAction(statsDock->toggleViewAction());
+    m_ui.menubar->insertMenu(m_ui.menuHelp->menuAction(), viewMenu);
+
     new QShortcut(QKeySequence(tr("Ctrl+q")), this, SLOT(close()));
 
     auto* guiAppMgr = GuiAppMgr::instance();
@@ -338,13 +350,22 @@ std::tuple<QString, bool> MainWindowWidget::loadMsgsDialog(bool askForClear)
 QString MainWindowWidget::saveMsgsDialog()
 {
     auto& msgsFileMgr = MsgFileMgrG::instanceRef();
-    return
+    QString selectedFilter;
+    auto filename =
         QFileDialog::getSaveFileName(
             this,
             tr("Save Messages to File"),
             msgsFileMgr.getLastFile(),
-            msgsFileMgr.getFilesFilter());
+            msgsFileMgr.getFilesFilter() + ";;" + MsgCsvExporter::getFilesFilter(),
+            &selectedFilter);
+
+    if ((!filename.isEmpty()) &&
+        (selectedFilter == MsgCsvExporter::getFilesFilter()) &&
+        (!MsgCsvExporter::isCsvFile(filename))) {
+        filename.append(".csv");
+    }
 
+    return filename;
 }
 
 }  // namespace cc_tools_qt
@@ -55,6 +55,11 @@ public slots:
         refreshImpl();
     }
 
+    void highlightData(int offset, int length)
+    {
+        highlightDataImpl(offset, length);
+    }
+
 signals:
     void sigMsgUpdated();
 
@@ -63,6 +68,7 @@ protected:
     virtual void setEditEnabledImpl(bool enabled) = 0;
     virtual void clearImpl() = 0;
     virtual void refreshImpl() = 0;
+    virtual void highlightDataImpl(int offset, int length) = 0;
 };
 
 }  // namespace cc_tools_qt
@@ -48,6 +48,7 @@ QString getMessageNameForList(ToolsMessagePtr msg)
 
 enum class Duration
 {
+    Microseconds,
     Milliseconds,
     Seconds,
     Minutes,
@@ -59,6 +60,7 @@ enum class Duration
 const QString& durationToString(Duration value)
 {
     static const QString Map[] = {
+        "microsec",
         "millisec",
         "sec",
         "min",
@@ -82,6 +84,10 @@ const QString& durationToString(Duration value)
 Duration stringToDuration(const QString& value)
 {
     static const std::map<QString, Duration> Map = {
+        std::make_pair("microseconds", Duration::Microseconds),
+        std::make_pair("microsecond", Duration::Microseconds),
+        std::make_pair("microsec", Duration::Microseconds),
+        std::make_pair("us", Duration::Microseconds),
         std::make_pair("milliseconds", Duration::Milliseconds),
         std::make_pair("millisecond", Duration::Milliseconds),
         std::make_pair("millisec", Duration::Milliseconds),
@@ -113,6 +119,7 @@ Duration stringToDuration(const QString& value)
 void fillDurationComboBox(QComboBox& box)
 {
     static const QString Strings[] = {
+        "microsecond(s)",
         "millisecond(s)",
         "second(s)",
         "minute(s)",
@@ -130,18 +137,19 @@ void fillDurationComboBox(QComboBox& box)
 }
 
 const long long unsigned DurationMul[] = {
-    1UL,
-    1UL * 1000,
-    1UL * 1000 * 60,
-    1UL * 1000 * 60 * 60,
-    1UL * 1000 * 60 * 60 * 24
+    1ULL,
+    1ULL * 1000,
+    1ULL * 1000 * 1000,
+    1ULL * 1000 * 1000 * 60,
+    1ULL * 1000 * 1000 * 60 * 60,
+    1ULL * 1000 * 1000 * 60 * 60 * 24
 };
 
 static_assert(
     std::extent<decltype(DurationMul)>::value == static_cast<long long unsigned>(Duration::NumOfDurations),
     "Incorrect mapping.");
 
-long long unsigned durationToMs(int value, Duration dur)
+long long unsigned durationToUs(int value, Duration dur)
 {
 
     if (Duration::NumOfDurations <= dur) {
@@ -154,7 +162,7 @@ long long unsigned durationToMs(int value, Duration dur)
     return static_cast<long long unsigned>(DurationMul[static_cast<std::size_t>(dur)] * castValue);
 }
 
-int msToDurationUnits(long long unsigned value, Duration dur)
+int usToDurationUnits(long long unsigned value, Duration dur)
 {
 
     if (Duration::NumOfDurations <= dur) {
@@ -166,6 +174,16 @@ int msToDurationUnits(long long unsigned value, Duration dur)
     return static_cast<int>(value / DurationMul[static_cast<std::size_t>(dur)]);
 }
 
+long long unsigned msgDurationUs(long long unsigned ms, long long unsigned us)
+{
+    // The microseconds value is relevant only when consistent with the milliseconds one
+    if ((us != 0U) && ((us / 1000U) == ms)) {
+        return us;
+    }
+
+    return ms * 1000U;
+}
+
 }  // namespace
 
 MessageUpdateDialog::MessageUpdateDialog(
@@ -222,19 +240,26 @@ MessageUpdateDialog::MessageUpdateDialog(
 
         auto delayUnits =
             stringToDuration(property::message::ToolsMsgDelayUnits().getFrom(*m_msg));
-        auto delay = msToDurationUnits(property::message::ToolsMsgDelay().getFrom(*m_msg), delayUnits);
+        auto delayUs =
+            msgDurationUs(
+                property::message::ToolsMsgDelay().getFrom(*m_msg),
+                property::message::ToolsMsgDelayUs().getFrom(*m_msg));
+        auto delay = usToDurationUnits(delayUs, delayUnits);
         if (delay != 0) {
             m_prevDelay = delay;
             m_ui.m_delayUnitsComboBox->setCurrentIndex(static_cast<int>(delayUnits));
             m_ui.m_delayCheckBox->setCheckState(Qt::Checked);
         }
 
-        auto repeatVal = property::message::ToolsMsgRepeatDuration().getFrom(*m_msg);
+        auto repeatVal =
+            msgDurationUs(
+                property::message::ToolsMsgRepeatDuration().getFrom(*m_msg),
+                property::message::ToolsMsgRepeatDurationUs().getFrom(*m_msg));
         auto repeatUnits =
             stringToDuration(
                 property::message::ToolsMsgRepeatDurationUnits().getFrom(*m_msg));
         auto repeatDuration =
-            msToDurationUnits(
+            usToDurationUnits(
                 repeatVal,
                 repeatUnits);
         if (repeatDuration != 0) {
@@ -481,14 +506,16 @@ void MessageUpdateDialog::accept()
 
     auto delayUnits =
         static_cast<Duration>(m_ui.m_delayUnitsComboBox->currentIndex());
-    property::message::ToolsMsgDelay().setTo(
-        durationToMs(m_ui.m_delaySpinBox->value(), delayUnits), *msg);
+    auto delayUs = durationToUs(m_ui.m_delaySpinBox->value(), delayUnits);
+    property::message::ToolsMsgDelay().setTo(delayUs / 1000U, *msg);
+    property::message::ToolsMsgDelayUs().setTo(delayUs, *msg);
     property::message::ToolsMsgDelayUnits().setTo(durationToString(delayUnits), *msg);
 
     auto repeatUnits =
         static_cast<Duration>(m_ui.m_repeatUnitsComboBox->currentIndex());
-    property::message::ToolsMsgRepeatDuration().setTo(
-        durationToMs(m_ui.m_repeatSpinBox->value(), repeatUnits), *msg);
+    auto repeatUs = durationToUs(m_ui.m_repeatSpinBox->value(), repeatUnits);
+    property::message::ToolsMsgRepeatDuration().setTo(repeatUs / 1000U, *msg);
+    property::message::ToolsMsgRepeatDurationUs().setTo(repeatUs, *msg);
     property::message::ToolsMsgRepeatDurationUnits().setTo(
         durationToString(repeatUnits), *msg);
     property::message::ToolsMsgRepeatCount().setTo(
@@ -45,6 +45,11 @@ void MessageWidget::disableEdit()
     setEditEnabled(false);
 }
 
+void MessageWidget::highlightData(int offset, int length)
+{
+    highlightDataImpl(offset, length);
+}
+
 void MessageWidget::emitMsgUpdated()
 {
     emit sigMsgUpdated();
@@ -35,6 +35,7 @@ public slots:
     void setEditEnabled(bool enabled);
     void enableEdit();
     void disableEdit();
+    void highlightData(int offset, int length);
 
 signals:
     void sigMsgUpdated();
@@ -44,6 +45,7 @@ protected:
 
     virtual void refreshImpl() = 0;
     virtual void setEditEnabledImpl(bool enabled) = 0;
+    virtual void highlightDataImpl(int offset, int length) = 0;
 };
 
 }  // namespace cc_tools_qt
@@ -76,25 +76,38 @@ void MsgDetailsWidget::setEditEnabled(bool enabled)
 void MsgDetailsWidget::displayMessage(ToolsMessagePtr msg)
 {
     assert(msg);
-    auto msgWidget = m_msgDisplayHandler.getMsgWidget(*msg);
-    assert(msgWidget);
+    // The message widgets are owned and reused by the display handler
+    bool sameWidget = false;
+    auto* msgWidget = m_msgDisplayHandler.getMsgWidget(msg, sameWidget);
+    assert(msgWidget != nullptr);
     msgWidget->setEditEnabled(m_editEnabled);
 
     connect(
-        msgWidget.get(), &MessageWidget::sigMsgUpdated,
-        this, &MsgDetailsWidget::sigMsgUpdated);
+        msgWidget, &MessageWidget::sigMsgUpdated,
+        this, &MsgDetailsWidget::sigMsgUpdated,
+        Qt::UniqueConnection);
 
     connect(
-        msgWidget.get(), &MessageWidget::sigMsgUpdated,
-        this, &MsgDetailsWidget::msgUpdated);
-
-    m_displayedMsgWidget = msgWidget.get();
+        msgWidget, &MessageWidget::sigMsgUpdated,
+        this, &MsgDetailsWidget::msgUpdated,
+        Qt::UniqueConnection);
 
     auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
     assert(scrollBar != nullptr);
     scrollBar->blockSignals(true);
-    m_ui.m_scrollArea->setWidget(msgWidget.release());
-    m_displayedMsgWidget->show();
+    if ((!sameWidget) || (m_displayedMsgWidget == nullptr)) {
+        // Taking the widget prevents its destruction by the scroll area,
+        // the message widgets are owned by the display handler, only
+        // the placeholder set by clear() needs to be deleted.
+        auto* prevWidget = m_ui.m_scrollArea->takeWidget();
+        if (m_displayedMsgWidget == nullptr) {
+            delete prevWidget;
+        }
+
+        m_displayedMsgWidget = msgWidget;
+        m_ui.m_scrollArea->setWidget(msgWidget);
+        m_displayedMsgWidget->show();
+    }
     scrollBar->blockSignals(false);
 
     auto scrollValue = property::message::ToolsMsgScrollPos().getFrom(*msg);
@@ -121,8 +134,13 @@ void MsgDetailsWidget::updateTitle(ToolsMessagePtr msg)
 
 void MsgDetailsWidget::clear()
 {
-    delete m_displayedMsgWidget;
-    m_displayedMsgWidget = nullptr;
+    if (m_displayedMsgWidget != nullptr) {
+        m_ui.m_scrollArea->takeWidget();
+        m_displayedMsgWidget = nullptr;
+    }
+
+    // The cached widgets may refer to the fields of the deleted messages
+    m_msgDisplayHandler.clear();
     m_displayedMsg.reset();
     m_ui.m_scrollArea->setWidget(new QWidget());
     m_ui.m_groupBox->setTitle(getTitlePrefix());
@@ -135,6 +153,13 @@ void MsgDetailsWidget::refresh()
     }
 }
 
+void MsgDetailsWidget::highlightData(int offset, int length)
+{
+    if (m_displayedMsgWidget != nullptr) {
+        m_displayedMsgWidget->highlightData(offset, length);
+    }
+}
+
 void MsgDetailsWidget::widgetScrolled(int value)
 {
     if (m_displayedMsg == nullptr) {
@@ -22,6 +22,7 @@
 
 #include "cc_tools_qt/ToolsMessage.h"
 
+#include <QtCore/QPointer>
 #include <QtWidgets/QWidget>
 
 #include <memory>
@@ -42,6 +43,7 @@ public slots:
     void updateTitle(ToolsMessagePtr msg);
     void clear();
     void refresh();
+    void highlightData(int offset, int length);
 
 signals:
     void sigMsgUpdated();
@@ -53,7 +55,7 @@ private slots:
 private:
     Ui::MsgDetailsWidget m_ui;
     DefaultMessageDisplayHandler m_msgDisplayHandler;
-    MessageWidget* m_displayedMsgWidget = nullptr;
+    QPointer<MessageWidget> m_displayedMsgWidget;
     ToolsMessagePtr m_displayedMsg;
     bool m_editEnabled = true;
 };
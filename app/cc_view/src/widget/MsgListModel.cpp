@@ -0,0 +1,175 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgListModel.h"
+
+#include <QtGui/QBrush>
+
+#include <cassert>
+#include <iterator>
+
+namespace cc_tools_qt
+{
+
+MsgListModel::MsgListModel(QObject* parentObj)
+  : Base(parentObj)
+{
+}
+
+MsgListModel::~MsgListModel() noexcept = default;
+
+int MsgListModel::rowCount(const QModelIndex& parentIdx) const
+{
+    if (parentIdx.isValid()) {
+        return 0;
+    }
+
+    return count();
+}
+
+QVariant MsgListModel::data(const QModelIndex& idx, int role) const
+{
+    if ((!idx.isValid()) || (count() <= idx.row())) {
+        return QVariant();
+    }
+
+    auto& msgPtr = m_msgs[static_cast<std::size_t>(idx.row())];
+    if (!msgPtr) {
+        // The row can be updated with an empty message
+        if (role == Qt::ForegroundRole) {
+            return QBrush(m_emptyMsgColour);
+        }
+
+        if (role == Qt::UserRole) {
+            return QVariant::fromValue(msgPtr);
+        }
+
+        return QVariant();
+    }
+
+    // The text and colour are evaluated only for the rows the view
+    // actually paints.
+    switch (role) {
+        case Qt::DisplayRole:
+            if (m_textFunc) {
+                return m_textFunc(*msgPtr);
+            }
+            return QString(msgPtr->name());
+
+        case Qt::ToolTipRole:
+            if (m_tooltipFunc) {
+                return m_tooltipFunc();
+            }
+            break;
+
+        case Qt::ForegroundRole:
+            if (m_colourFunc) {
+                return QBrush(m_colourFunc(*msgPtr));
+            }
+            break;
+
+        case Qt::UserRole:
+            return QVariant::fromValue(msgPtr);
+
+        default:
+            break;
+    }
+
+    return QVariant();
+}
+
+ToolsMessagePtr MsgListModel::msgAt(int row) const
+{
+    if ((row < 0) || (count() <= row)) {
+        return ToolsMessagePtr();
+    }
+
+    return m_msgs[static_cast<std::size_t>(row)];
+}
+
+void MsgListModel::appendMsg(ToolsMessagePtr msg)
+{
+    assert(msg);
+    auto row = count();
+    beginInsertRows(QModelIndex(), row, row);
+    m_msgs.push_back(std::move(msg));
+    endInsertRows();
+}
+
+void MsgListModel::updateMsg(int row, ToolsMessagePtr msg)
+{
+    assert((0 <= row) && (row < count()));
+    m_msgs[static_cast<std::size_t>(row)] = std::move(msg);
+    refreshRow(row);
+}
+
+void MsgListModel::refreshRow(int row)
+{
+    if ((row < 0) || (count() <= row)) {
+        return;
+    }
+
+    auto rowIdx = index(row);
+    emit dataChanged(rowIdx, rowIdx);
+}
+
+void MsgListModel::removeMsg(int row)
+{
+    assert((0 <= row) && (row < count()));
+    beginRemoveRows(QModelIndex(), row, row);
+    m_msgs.erase(m_msgs.begin() + row);
+    endRemoveRows();
+}
+
+void MsgListModel::moveMsg(int fromRow, int toRow)
+{
+    assert((0 <= fromRow) && (fromRow < count()));
+    assert((0 <= toRow) && (toRow < count()));
+    if (fromRow == toRow) {
+        return;
+    }
+
+    // Destination row is expressed as position before the move
+    auto destRow = toRow;
+    if (fromRow < toRow) {
+        ++destRow;
+    }
+
+    [[maybe_unused]] bool moveAllowed = beginMoveRows(QModelIndex(), fromRow, fromRow, QModelIndex(), destRow);
+    assert(moveAllowed);
+
+    auto msg = std::move(m_msgs[static_cast<std::size_t>(fromRow)]);
+    m_msgs.erase(m_msgs.begin() + fromRow);
+    m_msgs.insert(m_msgs.begin() + toRow, std::move(msg));
+    endMoveRows();
+}
+
+void MsgListModel::resetMsgs(MsgsList&& msgs)
+{
+    beginResetModel();
+    m_msgs = std::move(msgs);
+    endResetModel();
+}
+
+void MsgListModel::clear()
+{
+    beginResetModel();
+    m_msgs.clear();
+    endResetModel();
+}
+
+}  // namespace cc_tools_qt
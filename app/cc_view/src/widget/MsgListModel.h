@@ -0,0 +1,99 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QString>
+#include <QtCore/qnamespace.h>
+
+#include <functional>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+class MsgListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    using Base = QAbstractListModel;
+public:
+    using MsgsList = std::vector<ToolsMessagePtr>;
+    using TextFunc = std::function<QString (const ToolsMessage& msg)>;
+    using ColourFunc = std::function<Qt::GlobalColor (const ToolsMessage& msg)>;
+    using TooltipFunc = std::function<const QString& ()>;
+
+    MsgListModel(QObject* parentObj = nullptr);
+    ~MsgListModel() noexcept;
+
+    template <typename TFunc>
+    void setTextFunc(TFunc&& func)
+    {
+        m_textFunc = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setColourFunc(TFunc&& func)
+    {
+        m_colourFunc = std::forward<TFunc>(func);
+    }
+
+    void setEmptyMsgColour(Qt::GlobalColor colour)
+    {
+        m_emptyMsgColour = colour;
+    }
+
+    template <typename TFunc>
+    void setTooltipFunc(TFunc&& func)
+    {
+        m_tooltipFunc = std::forward<TFunc>(func);
+    }
+
+    virtual int rowCount(const QModelIndex& parentIdx = QModelIndex()) const override;
+    virtual QVariant data(const QModelIndex& idx, int role = Qt::DisplayRole) const override;
+
+    int count() const
+    {
+        return static_cast<int>(m_msgs.size());
+    }
+
+    const MsgsList& msgs() const
+    {
+        return m_msgs;
+    }
+
+    ToolsMessagePtr msgAt(int row) const;
+
+    void appendMsg(ToolsMessagePtr msg);
+    void updateMsg(int row, ToolsMessagePtr msg);
+    void refreshRow(int row);
+    void removeMsg(int row);
+    void moveMsg(int fromRow, int toRow);
+    void resetMsgs(MsgsList&& msgs);
+    void clear();
+
+private:
+    MsgsList m_msgs;
+    TextFunc m_textFunc;
+    ColourFunc m_colourFunc;
+    TooltipFunc m_tooltipFunc;
+    Qt::GlobalColor m_emptyMsgColour = Qt::red;
+};
+
+}  // namespace cc_tools_qt
@@ -18,14 +18,20 @@
 #include "MsgListWidget.h"
 
 #include "GuiAppMgr.h"
+#include "MsgCsvExporter.h"
 
 #include "cc_tools_qt/ToolsMessage.h"
 #include "cc_tools_qt/property/message.h"
 
+#include <QtCore/QItemSelectionModel>
 #include <QtCore/QVariant>
 #include <QtCore/QDateTime>
+#include <QtWidgets/QMessageBox>
+#include <QtWidgets/QProgressDialog>
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 
 namespace cc_tools_qt
 {
@@ -46,17 +52,41 @@ MsgListWidget::MsgListWidget(
 {
     m_ui.setupUi(this);
     m_ui.m_groupBoxLayout->insertWidget(0, toolbar);
+
+    m_model.setTextFunc(
+        [this](const ToolsMessage& msg)
+        {
+            return getMsgNameText(msg);
+        });
+
+    m_model.setColourFunc(
+        [this](const ToolsMessage& msg)
+        {
+            return getMsgColour(msg);
+        });
+
+    m_model.setEmptyMsgColour(defaultItemColour(false));
+
+    m_model.setTooltipFunc(
+        [this]() -> const QString&
+        {
+            return msgTooltipImpl();
+        });
+
+    m_ui.m_listView->setUniformItemSizes(true);
+    m_ui.m_listView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_ui.m_listView->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_ui.m_listView->setModel(&m_model);
     updateTitle();
 
-    m_ui.m_listWidget->setUniformItemSizes(true);
     connect(
-        m_ui.m_listWidget, &QListWidget::itemClicked,
+        m_ui.m_listView, &QListView::clicked,
         this, &MsgListWidget::itemClicked);
     connect(
-        m_ui.m_listWidget, &QListWidget::currentItemChanged,
+        m_ui.m_listView->selectionModel(), &QItemSelectionModel::currentChanged,
         this, &MsgListWidget::currentItemChanged);
     connect(
-        m_ui.m_listWidget, &QListWidget::itemDoubleClicked,
+        m_ui.m_listView, &QListView::doubleClicked,
         this, &MsgListWidget::itemDoubleClicked);
 
     auto* guiMgr = GuiAppMgr::instance();
@@ -69,87 +99,60 @@ MsgListWidget::MsgListWidget(
 void MsgListWidget::addMessage(ToolsMessagePtr msg)
 {
     assert(msg);
-    m_ui.m_listWidget->addItem(getMsgNameText(msg));
-    auto* item = m_ui.m_listWidget->item(m_ui.m_listWidget->count() - 1);
-    item->setToolTip(msgTooltipImpl());
-
-    bool valid = msg->isValid();
-
-    auto type = property::message::ToolsMsgType().getFrom(*msg);
-    if ((type != MsgType::Invalid) && (!msg->idAsString().isEmpty())) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
-    }
-
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
+    m_model.appendMsg(std::move(msg));
 
     if (m_selectOnAdd) {
-        m_ui.m_listWidget->blockSignals(true);
-        m_ui.m_listWidget->setCurrentRow(m_ui.m_listWidget->count() - 1);
-        m_ui.m_listWidget->blockSignals(false);
-        assert(m_ui.m_listWidget->currentItem() == item);
+        setCurrentRow(m_model.count() - 1);
     }
 
-    if (m_ui.m_listWidget->currentRow() < 0) {
-        m_ui.m_listWidget->scrollToBottom();
+    if (currentRow() < 0) {
+        m_ui.m_listView->scrollToBottom();
     }
 
     updateTitle();
 }
 
+void MsgListWidget::resetMessages(GuiAppMgr::MsgsIndexPtr msgs)
+{
+    assert(msgs);
+    m_model.resetMsgs(std::move(*msgs));
+    m_selectedIndex = QPersistentModelIndex();
+    m_lastSelectionTimestamp = 0;
+    m_ui.m_listView->scrollToBottom();
+    updateTitle();
+}
+
 void MsgListWidget::updateCurrentMessage(ToolsMessagePtr msg)
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_for_update = false;
         assert(No_item_is_selected_for_update);
         return;
     }
 
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
-
-    item->setText(getMsgNameText(msg));
-
-    if ((!msg) || (msg->idAsString().isEmpty())) {
-        item->setForeground(defaultItemColour(false));
-        return;
-    }
-
-    bool valid = msg->isValid();
-
-    auto type = property::message::ToolsMsgType().getFrom(*msg);
-    if (type != MsgType::Invalid) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
-    }
+    m_model.updateMsg(row, std::move(msg));
 }
 
 void MsgListWidget::deleteCurrentMessage()
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_for_deletion = false;
         assert(No_item_is_selected_for_deletion);
         return;
     }
 
-    m_ui.m_listWidget->blockSignals(true);
-    delete item; // will remove from the list
-    m_ui.m_listWidget->blockSignals(false);
+    m_currentChangeIgnored = true;
+    m_model.removeMsg(row);
+    m_currentChangeIgnored = false;
 
     updateTitle();
 
-    auto* nextItem = m_ui.m_listWidget->currentItem();
-    if (nextItem != nullptr) {
-        processClick(nextItem);
+    auto nextIdx = m_ui.m_listView->currentIndex();
+    m_selectedIndex = nextIdx;
+    if (nextIdx.isValid()) {
+        processClick(nextIdx);
     }
 }
 
@@ -160,20 +163,15 @@ void MsgListWidget::selectOnAdd(bool enabled)
 
 void MsgListWidget::clearSelection()
 {
-    m_ui.m_listWidget->clearSelection();
-    m_ui.m_listWidget->setCurrentRow(-1);
+    m_ui.m_listView->clearSelection();
+    m_ui.m_listView->setCurrentIndex(QModelIndex());
 }
 
 void MsgListWidget::clearList(bool reportDeleted)
 {
     ToolsMessagesList msgsList;
     if (reportDeleted) {
-        auto count = m_ui.m_listWidget->count();
-        for (auto idx = 0; idx < count; ++idx) {
-            auto* item = m_ui.m_listWidget->item(idx);
-            auto msg = getMsgFromItem(item);
-            msgsList.push_back(std::move(msg));
-        }
+        msgsList = allMsgs();
     }
 
     clearList();
@@ -185,7 +183,9 @@ void MsgListWidget::clearList(bool reportDeleted)
 
 void MsgListWidget::clearList()
 {
-    m_ui.m_listWidget->clear();
+    m_model.clear();
+    m_selectedIndex = QPersistentModelIndex();
+    m_lastSelectionTimestamp = 0;
     updateTitle();
 }
 
@@ -196,7 +196,7 @@ void MsgListWidget::stateChanged(int state)
 
 void MsgListWidget::moveSelectedTop()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = currentRow();
     if (curRow <= 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_up_top_item = false;
         assert(No_item_is_selected_or_moving_up_top_item);
@@ -208,7 +208,7 @@ void MsgListWidget::moveSelectedTop()
 
 void MsgListWidget::moveSelectedUp()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = currentRow();
     if (curRow <= 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_up_top_item = false;
         assert(No_item_is_selected_or_moving_up_top_item);
@@ -220,8 +220,8 @@ void MsgListWidget::moveSelectedUp()
 
 void MsgListWidget::moveSelectedDown()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = currentRow();
+    if ((curRow < 0) || ((m_model.count() - 1) <= curRow)) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_down_bottom_item = false;
         assert(No_item_is_selected_or_moving_down_bottom_item);
         return;
@@ -232,14 +232,14 @@ void MsgListWidget::moveSelectedDown()
 
 void MsgListWidget::moveSelectedBottom()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = currentRow();
+    if ((curRow < 0) || ((m_model.count() - 1) <= curRow)) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_down_bottom_item = false;
         assert(No_item_is_selected_or_moving_down_bottom_item);
         return;
     }
 
-    moveItem(curRow, m_ui.m_listWidget->count() - 1);
+    moveItem(curRow, m_model.count() - 1);
 }
 
 void MsgListWidget::titleNeedsUpdate()
@@ -262,15 +262,91 @@ void MsgListWidget::loadMessages(
 
 void MsgListWidget::saveMessages(const QString& filename)
 {
+    if (MsgCsvExporter::isCsvFile(filename)) {
+        exportCsv(filename);
+        return;
+    }
+
     saveMessagesImpl(filename);
 }
 
+void MsgListWidget::csvExportProgress(unsigned long long done, unsigned long long total)
+{
+    if (m_csvExportProgress == nullptr) {
+        return;
+    }
+
+    // Reported in percents to fit the int range
+    int value = 100;
+    if (total != 0U) {
+        value = static_cast<int>((done * 100U) / total);
+    }
+
+    m_csvExportProgress->setValue(value);
+}
+
+void MsgListWidget::csvExportFinished(bool success, bool cancelled)
+{
+    if (m_csvExportProgress != nullptr) {
+        m_csvExportProgress->deleteLater();
+        m_csvExportProgress = nullptr;
+    }
+
+    assert(m_csvExporter != nullptr);
+    auto filename = m_csvExportFilename;
+    m_csvExporter->deleteLater();
+    m_csvExporter = nullptr;
+
+    if (success || cancelled) {
+        return;
+    }
+
+    QMessageBox::critical(
+        this,
+        tr("Export error occurred!"),
+        tr("Failed to export messages to \"%1\".").arg(filename));
+}
+
 void MsgListWidget::selectMsg(int idx)
 {
-    assert(idx < m_ui.m_listWidget->count());
-    m_ui.m_listWidget->blockSignals(true);
-    m_ui.m_listWidget->setCurrentRow(idx);
-    m_ui.m_listWidget->blockSignals(false);
+    assert(idx < m_model.count());
+    setCurrentRow(idx);
+}
+
+void MsgListWidget::findMsg(MsgQuery::Ptr query, bool forward)
+{
+    assert(query);
+    if (m_model.count() == 0) {
+        return;
+    }
+
+    auto foundRow = query->find(m_model.msgs(), findStartRow(forward), forward);
+    selectFoundRow(foundRow);
+}
+
+void MsgListWidget::selectFoundData(ToolsMessagePtr msg, DataPattern::Ptr pattern)
+{
+    assert(msg);
+    assert(pattern);
+    auto& msgs = m_model.msgs();
+    auto iter = std::find(msgs.begin(), msgs.end(), msg);
+    if (iter == msgs.end()) {
+        return;
+    }
+
+    auto foundRow = static_cast<int>(std::distance(msgs.begin(), iter));
+    if (!selectFoundRow(foundRow)) {
+        return;
+    }
+
+    auto offset = pattern->find(*msg);
+    if (offset == DataPattern::NotFound) {
+        [[maybe_unused]] static constexpr bool Should_not_happen = false;
+        assert(Should_not_happen);
+        return;
+    }
+
+    dataMatchSelectedImpl(static_cast<int>(offset), static_cast<int>(pattern->size()));
 }
 
 void MsgListWidget::msgClickedImpl([[maybe_unused]] ToolsMessagePtr msg, [[maybe_unused]] int idx)
@@ -323,29 +399,27 @@ void MsgListWidget::saveMessagesImpl([[maybe_unused]] const QString& filename)
 {
 }
 
+void MsgListWidget::dataMatchSelectedImpl([[maybe_unused]] int offset, [[maybe_unused]] int length)
+{
+}
+
 ToolsMessagePtr MsgListWidget::currentMsg() const
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    assert(item != nullptr);
-    return getMsgFromItem(item);
+    auto msg = m_model.msgAt(currentRow());
+    assert(msg);
+    return msg;
 }
 
 ToolsMessagesList MsgListWidget::allMsgs() const
 {
-    ToolsMessagesList allMsgsList;
-    for (auto idx = 0; idx < m_ui.m_listWidget->count(); ++idx) {
-        auto* item = m_ui.m_listWidget->item(idx);
-        auto msgPtr = getMsgFromItem(item);
-        assert(msgPtr);
-        allMsgsList.push_back(std::move(msgPtr));
-    }
-    return allMsgsList;
+    auto& msgs = m_model.msgs();
+    return ToolsMessagesList(msgs.begin(), msgs.end());
 }
 
-void MsgListWidget::itemClicked(QListWidgetItem* item)
+void MsgListWidget::itemClicked(const QModelIndex& index)
 {
-    assert(item != nullptr);
-    if (m_selectedItem == item) {
+    assert(index.isValid());
+    if (m_selectedIndex == index) {
         assert(0 < m_lastSelectionTimestamp);
         auto timestamp = QDateTime::currentMSecsSinceEpoch();
         static const decltype(timestamp) MinThreshold = 250;
@@ -354,13 +428,17 @@ void MsgListWidget::itemClicked(QListWidgetItem* item)
         }
     }
 
-    processClick(item);
+    processClick(index);
 }
 
-void MsgListWidget::currentItemChanged(QListWidgetItem* current, [[maybe_unused]] QListWidgetItem* prev)
+void MsgListWidget::currentItemChanged(const QModelIndex& current, [[maybe_unused]] const QModelIndex& prev)
 {
-    m_selectedItem = current;
-    if (current != nullptr) {
+    if (m_currentChangeIgnored) {
+        return;
+    }
+
+    m_selectedIndex = current;
+    if (current.isValid()) {
         m_lastSelectionTimestamp = QDateTime::currentMSecsSinceEpoch();
         processClick(current);
         return;
@@ -370,49 +448,52 @@ void MsgListWidget::currentItemChanged(QListWidgetItem* current, [[maybe_unused]
     return;
 }
 
-void MsgListWidget::itemDoubleClicked(QListWidgetItem* item)
+void MsgListWidget::itemDoubleClicked(const QModelIndex& index)
 {
     msgDoubleClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model.msgAt(index.row()),
+        index.row());
 }
 
 void MsgListWidget::msgCommentUpdated(ToolsMessagePtr msg)
 {
     assert(msg);
-    auto item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         return;
     }
 
-    if (msg == getMsgFromItem(item)) {
-        item->setText(getMsgNameText(msg));
+    if (msg == m_model.msgAt(row)) {
+        m_model.refreshRow(row);
     }
 }
 
-ToolsMessagePtr MsgListWidget::getMsgFromItem(QListWidgetItem* item) const
-{
-    auto var = item->data(Qt::UserRole);
-    assert(var.canConvert<ToolsMessagePtr>());
-    return var.value<ToolsMessagePtr>();
-}
-
-QString MsgListWidget::getMsgNameText(ToolsMessagePtr msg)
+QString MsgListWidget::getMsgNameText(const ToolsMessage& msg) const
 {
-    assert(msg);
-    auto itemStr = msgPrefixImpl(*msg);
+    auto itemStr = msgPrefixImpl(msg);
     if (!itemStr.isEmpty()) {
         itemStr.append(": ");
     }
-    itemStr.append(msg->name());
+    itemStr.append(msg.name());
 
-    auto comment = property::message::ToolsMsgComment().getFrom(*msg);
+    auto comment = property::message::ToolsMsgComment().getFrom(msg);
     if (!comment.isEmpty()) {
         itemStr.append(" (" + comment + ")");
     }
     return itemStr;
 }
 
+Qt::GlobalColor MsgListWidget::getMsgColour(const ToolsMessage& msg) const
+{
+    bool valid = msg.isValid();
+    auto type = property::message::ToolsMsgType().getFrom(msg);
+    if ((type != MsgType::Invalid) && (!msg.idAsString().isEmpty())) {
+        return getItemColourImpl(type, valid);
+    }
+
+    return defaultItemColour(valid);
+}
+
 Qt::GlobalColor MsgListWidget::defaultItemColour(bool valid) const
 {
     if (valid) {
@@ -421,30 +502,106 @@ Qt::GlobalColor MsgListWidget::defaultItemColour(bool valid) const
     return Qt::red;
 }
 
+int MsgListWidget::currentRow() const
+{
+    auto current = m_ui.m_listView->currentIndex();
+    if (!current.isValid()) {
+        return -1;
+    }
+
+    return current.row();
+}
+
+void MsgListWidget::setCurrentRow(int row)
+{
+    m_currentChangeIgnored = true;
+    if (row < 0) {
+        m_ui.m_listView->setCurrentIndex(QModelIndex());
+    }
+    else {
+        m_ui.m_listView->setCurrentIndex(m_model.index(row));
+    }
+    m_currentChangeIgnored = false;
+}
+
+int MsgListWidget::findStartRow(bool forward) const
+{
+    auto row = currentRow();
+    if (0 <= row) {
+        return forward ? (row + 1) : (row - 1);
+    }
+
+    if (forward) {
+        return 0;
+    }
+
+    return m_model.count() - 1;
+}
+
+bool MsgListWidget::selectFoundRow(int row)
+{
+    if (row < 0) {
+        return false;
+    }
+
+    // Selection of the found row is reported as a regular click
+    auto foundIdx = m_model.index(row);
+    m_ui.m_listView->setCurrentIndex(foundIdx);
+    m_ui.m_listView->scrollTo(foundIdx);
+    return true;
+}
+
 void MsgListWidget::moveItem(int fromRow, int toRow)
 {
-    assert(fromRow < m_ui.m_listWidget->count());
-    auto* item = m_ui.m_listWidget->takeItem(fromRow);
-    assert(toRow <= m_ui.m_listWidget->count());
-    m_ui.m_listWidget->insertItem(toRow, item);
-    m_ui.m_listWidget->setCurrentRow(toRow);
+    assert(fromRow < m_model.count());
+    assert(toRow < m_model.count());
+    m_model.moveMsg(fromRow, toRow);
+    setCurrentRow(toRow);
+    m_ui.m_listView->scrollTo(m_ui.m_listView->currentIndex());
     msgMovedImpl(toRow);
 }
 
+void MsgListWidget::exportCsv(const QString& filename)
+{
+    if (m_csvExporter != nullptr) {
+        QMessageBox::warning(
+            this,
+            tr("Export in progress"),
+            tr("The previous export to \"%1\" hasn't finished yet.").arg(m_csvExportFilename));
+        return;
+    }
+
+    m_csvExportFilename = filename;
+    m_csvExporter = new MsgCsvExporter(this);
+    connect(
+        m_csvExporter, &MsgCsvExporter::sigProgress,
+        this, &MsgListWidget::csvExportProgress);
+    connect(
+        m_csvExporter, &MsgCsvExporter::sigFinished,
+        this, &MsgListWidget::csvExportFinished);
+
+    m_csvExportProgress = new QProgressDialog(tr("Exporting messages to \"%1\"...").arg(filename), tr("Cancel"), 0, 100, this);
+    m_csvExportProgress->setWindowModality(Qt::WindowModal);
+    connect(
+        m_csvExportProgress, &QProgressDialog::canceled,
+        m_csvExporter, &MsgCsvExporter::cancel);
+
+    m_csvExporter->start(filename, allMsgs());
+}
+
 void MsgListWidget::updateTitle()
 {
     auto title =
         m_title +
-        QString(" [%1]").arg(m_ui.m_listWidget->count(), 1, 10, QChar('0'));
+        QString(" [%1]").arg(m_model.count(), 1, 10, QChar('0'));
     m_ui.m_groupBox->setTitle(title);
 }
 
-void MsgListWidget::processClick(QListWidgetItem* item)
+void MsgListWidget::processClick(const QModelIndex& index)
 {
     msgClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model.msgAt(index.row()),
+        index.row());
 }
 
 }  // namespace cc_tools_qt
-
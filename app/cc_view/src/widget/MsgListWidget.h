@@ -17,20 +17,27 @@
 
 #pragma once
 
+#include "DataPattern.h"
 #include "GuiAppMgr.h"
+#include "MsgListModel.h"
+#include "MsgQuery.h"
 #include "ui_MsgListWidget.h"
 
 #include "cc_tools_qt/ToolsMessage.h"
 #include "cc_tools_qt/ToolsProtocol.h"
 
+#include <QtCore/QPersistentModelIndex>
 #include <QtCore/QString>
 #include <QtCore/qnamespace.h>
 #include <QtWidgets/QWidget>
 
+class QProgressDialog;
+
 namespace cc_tools_qt
 {
 
 class ToolsMessage;
+class MsgCsvExporter;
 
 class MsgListWidget : public QWidget
 {
@@ -46,6 +53,7 @@ public:
 
 protected slots:
     void addMessage(ToolsMessagePtr msg);
+    void resetMessages(GuiAppMgr::MsgsIndexPtr msgs);
     void updateCurrentMessage(ToolsMessagePtr msg);
     void deleteCurrentMessage();
     void selectOnAdd(bool enabled);
@@ -61,6 +69,8 @@ protected slots:
     void loadMessages(bool clearExisting, const QString& filename, ToolsProtocolPtr protocol);
     void saveMessages(const QString& filename);
     void selectMsg(int idx);
+    void findMsg(MsgQuery::Ptr query, bool forward);
+    void selectFoundData(ToolsMessagePtr msg, DataPattern::Ptr pattern);
 
 protected:
     virtual void msgClickedImpl(ToolsMessagePtr msg, int idx);
@@ -74,29 +84,42 @@ protected:
     virtual QString getTitleImpl() const;
     virtual void loadMessagesImpl(const QString& filename, ToolsProtocol& protocol);
     virtual void saveMessagesImpl(const QString& filename);
+    virtual void dataMatchSelectedImpl(int offset, int length);
 
     ToolsMessagePtr currentMsg() const;
     ToolsMessagesList allMsgs() const;
 
 private slots:
-    void itemClicked(QListWidgetItem* item);
-    void currentItemChanged(QListWidgetItem* current, QListWidgetItem* prev);
-    void itemDoubleClicked(QListWidgetItem* item);
+    void itemClicked(const QModelIndex& index);
+    void currentItemChanged(const QModelIndex& current, const QModelIndex& prev);
+    void itemDoubleClicked(const QModelIndex& index);
     void msgCommentUpdated(ToolsMessagePtr msg);
+    void csvExportProgress(unsigned long long done, unsigned long long total);
+    void csvExportFinished(bool success, bool cancelled);
 
 private:
-    ToolsMessagePtr getMsgFromItem(QListWidgetItem* item) const;
-    QString getMsgNameText(ToolsMessagePtr msg);
+    QString getMsgNameText(const ToolsMessage& msg) const;
+    Qt::GlobalColor getMsgColour(const ToolsMessage& msg) const;
     Qt::GlobalColor defaultItemColour(bool valid) const;
+    int currentRow() const;
+    void setCurrentRow(int row);
+    int findStartRow(bool forward) const;
+    bool selectFoundRow(int row);
     void moveItem(int fromRow, int toRow);
     void updateTitle();
-    void processClick(QListWidgetItem* item);
+    void processClick(const QModelIndex& index);
+    void exportCsv(const QString& filename);
 
     Ui::MsgListWidget m_ui;
+    MsgListModel m_model;
     bool m_selectOnAdd = false;
+    bool m_currentChangeIgnored = false;
     QString m_title;
     qint64 m_lastSelectionTimestamp = 0;
-    QListWidgetItem* m_selectedItem = nullptr;
+    QPersistentModelIndex m_selectedIndex;
+    MsgCsvExporter* m_csvExporter = nullptr;
+    QProgressDialog* m_csvExportProgress = nullptr;
+    QString m_csvExportFilename;
 };
 
 }  // namespace cc_tools_qt
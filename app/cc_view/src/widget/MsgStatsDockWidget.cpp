@@ -0,0 +1,333 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgStatsDockWidget.h"
+
+#include "MsgMgrG.h"
+
+#include <QtCore/QStringList>
+#include <QtGui/QBrush>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QTabWidget>
+#include <QtWidgets/QVBoxLayout>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+enum Column
+{
+    Column_Name,
+    Column_Id,
+    Column_Direction,
+    Column_Count,
+    Column_Invalid,
+    Column_Bytes,
+    Column_Rate1sec,
+    Column_Rate10sec,
+    Column_Rate60sec,
+    Column_InterArrival,
+    Column_NumOfValues
+};
+
+enum TimingColumn
+{
+    TimingColumn_Name,
+    TimingColumn_RequestedPeriod,
+    TimingColumn_AchievedPeriod,
+    TimingColumn_MeanLateness,
+    TimingColumn_MaxLateness,
+    TimingColumn_Count,
+    TimingColumn_Missed,
+    TimingColumn_NumOfValues
+};
+
+const int RefreshPeriodMs = 1000;
+
+// The last second rate differing from the last minute one by this
+// factor is reported as anomaly.
+const double AnomalyFactor = 2.0;
+
+const QStringList& columnNames()
+{
+    static const QStringList Names = {
+        "Name",
+        "ID",
+        "Direction",
+        "Count",
+        "Invalid",
+        "Bytes",
+        "Rate 1s",
+        "Rate 10s",
+        "Rate 60s",
+        "Inter-arrival",
+    };
+
+    assert(Names.size() == Column_NumOfValues);
+    return Names;
+}
+
+const QStringList& timingColumnNames()
+{
+    static const QStringList Names = {
+        "Name",
+        "Requested period (us)",
+        "Achieved period (us)",
+        "Mean lateness (us)",
+        "Max lateness (us)",
+        "Count",
+        "Missed",
+    };
+
+    assert(Names.size() == TimingColumn_NumOfValues);
+    return Names;
+}
+
+QString directionStr(ToolsMsgStats::MsgType type)
+{
+    if (type == ToolsMsgStats::MsgType::Sent) {
+        return "Sent";
+    }
+
+    return "Received";
+}
+
+QString decimalStr(double rate)
+{
+    return QString::number(rate, 'f', 1);
+}
+
+QString binRangeStr(unsigned bin)
+{
+    if (bin == 0U) {
+        return "< 1 ms";
+    }
+
+    auto from = 1ULL << (bin - 1U);
+    if (bin == (ToolsMsgStats::HistogramBinsCount - 1U)) {
+        return QString(">= %1 ms").arg(from);
+    }
+
+    return QString("%1 - %2 ms").arg(from).arg((1ULL << bin) - 1U);
+}
+
+QString histogramTooltip(const ToolsMsgStats::Histogram& histogram)
+{
+    QStringList lines;
+    for (auto bin = 0U; bin < histogram.size(); ++bin) {
+        if (histogram[bin] == 0U) {
+            continue;
+        }
+
+        lines.append(QString("%1: %2").arg(binRangeStr(bin)).arg(histogram[bin]));
+    }
+
+    return lines.join('\n');
+}
+
+bool isAnomaly(const ToolsMsgStats::Entry& entry)
+{
+    auto lastSec = entry.m_rates[ToolsMsgStats::RateWindow_1sec];
+    auto lastMin = entry.m_rates[ToolsMsgStats::RateWindow_60sec];
+    if (lastMin <= 0.0) {
+        return false;
+    }
+
+    return (lastMin * AnomalyFactor < lastSec) || (lastSec * AnomalyFactor < lastMin);
+}
+
+} // namespace
+
+MsgStatsDockWidget::MsgStatsDockWidget(QWidget* parentObj) :
+    Base(tr("Traffic Statistics"), parentObj),
+    m_table(new QTableWidget(0, Column_NumOfValues)),
+    m_timingTable(new QTableWidget(0, TimingColumn_NumOfValues)),
+    m_socketQueueLabel(new QLabel())
+{
+    setObjectName("MsgStatsDockWidget");
+
+    m_table->setHorizontalHeaderLabels(columnNames());
+    m_timingTable->setHorizontalHeaderLabels(timingColumnNames());
+    for (auto* table : {m_table, m_timingTable}) {
+        table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        table->setSelectionMode(QAbstractItemView::NoSelection);
+        table->verticalHeader()->hide();
+        table->horizontalHeader()->setStretchLastSection(true);
+    }
+
+    auto* tabs = new QTabWidget();
+    tabs->addTab(m_table, tr("Traffic"));
+    tabs->addTab(m_timingTable, tr("Send Timing"));
+
+    auto* resetButton = new QPushButton(tr("Reset"));
+    connect(
+        resetButton, &QPushButton::clicked,
+        this, &MsgStatsDockWidget::resetStats);
+
+    auto* buttonsLayout = new QHBoxLayout();
+    buttonsLayout->addWidget(m_socketQueueLabel);
+    buttonsLayout->addStretch();
+    buttonsLayout->addWidget(resetButton);
+
+    auto* contents = new QWidget();
+    auto* layout = new QVBoxLayout();
+    layout->addWidget(tabs);
+    layout->addLayout(buttonsLayout);
+    contents->setLayout(layout);
+    setWidget(contents);
+
+    m_timer.setInterval(RefreshPeriodMs);
+    connect(
+        &m_timer, &QTimer::timeout,
+        this, &MsgStatsDockWidget::refresh);
+}
+
+MsgStatsDockWidget::~MsgStatsDockWidget() noexcept = default;
+
+void MsgStatsDockWidget::showEvent(QShowEvent* event)
+{
+    Base::showEvent(event);
+    refresh();
+    m_timer.start();
+}
+
+void MsgStatsDockWidget::hideEvent(QHideEvent* event)
+{
+    m_timer.stop();
+    Base::hideEvent(event);
+}
+
+void MsgStatsDockWidget::refresh()
+{
+    refreshTraffic();
+    refreshSendTiming();
+    refreshSocketQueue();
+}
+
+void MsgStatsDockWidget::resetStats()
+{
+    MsgMgrG::instanceRef().clearStats();
+    refresh();
+}
+
+void MsgStatsDockWidget::refreshTraffic()
+{
+    auto entries = MsgMgrG::instanceRef().getStats().snapshot(ToolsMsgStats::currentTimestamp());
+    m_table->setRowCount(static_cast<int>(entries.size()));
+    for (auto idx = 0U; idx < entries.size(); ++idx) {
+        auto& entry = entries[idx];
+        auto row = static_cast<int>(idx);
+        setCell(*m_table, row, Column_Name, entry.m_name);
+        setCell(*m_table, row, Column_Id, entry.m_id);
+        setCell(*m_table, row, Column_Direction, directionStr(entry.m_type));
+        setCell(*m_table, row, Column_Count, QString::number(entry.m_count));
+        setCell(*m_table, row, Column_Invalid, QString::number(entry.m_invalidCount));
+        setCell(*m_table, row, Column_Bytes, QString::number(entry.m_bytes));
+        setCell(*m_table, row, Column_Rate1sec, decimalStr(entry.m_rates[ToolsMsgStats::RateWindow_1sec]));
+        setCell(*m_table, row, Column_Rate10sec, decimalStr(entry.m_rates[ToolsMsgStats::RateWindow_10sec]));
+        setCell(*m_table, row, Column_Rate60sec, decimalStr(entry.m_rates[ToolsMsgStats::RateWindow_60sec]));
+
+        auto& histogram = entry.m_interArrival;
+        auto maxIter = std::max_element(histogram.begin(), histogram.end());
+        QString interArrivalStr;
+        if (*maxIter != 0U) {
+            interArrivalStr = binRangeStr(static_cast<unsigned>(std::distance(histogram.begin(), maxIter)));
+        }
+        setCell(*m_table, row, Column_InterArrival, interArrivalStr, histogramTooltip(histogram));
+        setRowHighlighted(row, isAnomaly(entry));
+    }
+}
+
+void MsgStatsDockWidget::refreshSendTiming()
+{
+    auto entries = GuiAppMgr::instanceRef().sendTimingStats();
+    auto& table = *m_timingTable;
+    table.setRowCount(static_cast<int>(entries.size()));
+    for (auto idx = 0U; idx < entries.size(); ++idx) {
+        auto& entry = entries[idx];
+        auto row = static_cast<int>(idx);
+        setCell(table, row, TimingColumn_Name, entry.m_name);
+        setCell(table, row, TimingColumn_RequestedPeriod, QString::number(entry.m_requestedPeriod));
+        setCell(table, row, TimingColumn_AchievedPeriod, decimalStr(entry.m_achievedPeriod));
+        setCell(table, row, TimingColumn_MeanLateness, decimalStr(entry.m_meanLateness));
+        setCell(table, row, TimingColumn_MaxLateness, QString::number(entry.m_maxLateness));
+        setCell(table, row, TimingColumn_Count, QString::number(entry.m_count));
+        setCell(table, row, TimingColumn_Missed, QString::number(entry.m_missedCount));
+    }
+}
+
+void MsgStatsDockWidget::refreshSocketQueue()
+{
+    auto socket = MsgMgrG::instanceRef().getSocket();
+    if (!socket) {
+        m_socketQueueLabel->clear();
+        return;
+    }
+
+    auto text = tr("Socket queue: %1 bytes").arg(socket->pendingBytes());
+    if (GuiAppMgr::instanceRef().isSendPaused()) {
+        text += tr(" (sending paused)");
+    }
+
+    auto dropped = socket->droppedCount();
+    if (dropped != 0U) {
+        text += tr(", incoming dropped: %1").arg(dropped);
+    }
+
+    m_socketQueueLabel->setText(text);
+    m_socketQueueLabel->setToolTip(
+        tr("Sending pauses when %1 bytes are queued and resumes when %2 bytes are left")
+            .arg(socket->highWatermark())
+            .arg(socket->lowWatermark()));
+}
+
+void MsgStatsDockWidget::setCell(QTableWidget& table, int row, int col, const QString& text, const QString& tooltip)
+{
+    auto* item = table.item(row, col);
+    if (item == nullptr) {
+        item = new QTableWidgetItem();
+        table.setItem(row, col, item);
+    }
+
+    item->setText(text);
+    item->setToolTip(tooltip);
+}
+
+void MsgStatsDockWidget::setRowHighlighted(int row, bool highlighted)
+{
+    QBrush brush;
+    if (highlighted) {
+        brush = QBrush(Qt::yellow);
+    }
+
+    for (auto col = 0; col < Column_NumOfValues; ++col) {
+        auto* item = m_table->item(row, col);
+        assert(item != nullptr);
+        item->setBackground(brush);
+    }
+}
+
+}  // namespace cc_tools_qt
@@ -0,0 +1,61 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "cc_tools_qt/ToolsMsgStats.h"
+
+#include <QtCore/QTimer>
+#include <QtWidgets/QDockWidget>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QTableWidget>
+
+#include "GuiAppMgr.h"
+
+namespace cc_tools_qt
+{
+
+class MsgStatsDockWidget : public QDockWidget
+{
+    Q_OBJECT
+    using Base = QDockWidget;
+public:
+    explicit MsgStatsDockWidget(QWidget* parentObj = nullptr);
+    ~MsgStatsDockWidget() noexcept;
+
+protected:
+    virtual void showEvent(QShowEvent* event) override;
+    virtual void hideEvent(QHideEvent* event) override;
+
+private slots:
+    void refresh();
+    void resetStats();
+
+private:
+    void refreshTraffic();
+    void refreshSendTiming();
+    void refreshSocketQueue();
+    static void setCell(QTableWidget& table, int row, int col, const QString& text, const QString& tooltip = QString());
+    void setRowHighlighted(int row, bool highlighted);
+
+    QTableWidget* m_table = nullptr;
+    QTableWidget* m_timingTable = nullptr;
+    QLabel* m_socketQueueLabel = nullptr;
+    QTimer m_timer;
+};
+
+}  // namespace cc_tools_qt
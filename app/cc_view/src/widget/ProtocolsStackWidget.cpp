@@ -29,6 +29,7 @@ namespace
 
 const char* ApplicationStr = "Application";
 const char* ExtraInfoStr ="Extra Info";
+const char* RawDataStr = "Raw Data";
 
 } // namespace
 
@@ -126,7 +127,7 @@ void ProtocolsStackWidget::displayMessage(ToolsMessagePtr msg, bool force)
         addMsgFunc(msg, ApplicationStr);
     }
     addMsgFunc(property::message::ToolsMsgTransportMsg().getFrom(*msg), "Transport");
-    addMsgFunc(property::message::ToolsMsgRawDataMsg().getFrom(*msg), "Raw Data");
+    addMsgFunc(property::message::ToolsMsgRawDataMsg().getFrom(*msg), RawDataStr);
     addMsgFunc(property::message::ToolsMsgExtraInfoMsg().getFrom(*msg), ExtraInfoStr);
 
     m_ui.m_protocolsTreeWidget->addTopLevelItem(topLevelItem);
@@ -168,6 +169,29 @@ bool ProtocolsStackWidget::isExtraInfoSelected()
     return currentItem->text(0) == ExtraInfoStr;
 }
 
+bool ProtocolsStackWidget::selectRawData()
+{
+    auto* topProtocolItem = m_ui.m_protocolsTreeWidget->topLevelItem(0);
+    if (topProtocolItem == nullptr) {
+        return false;
+    }
+
+    for (auto idx = 0; idx < topProtocolItem->childCount(); ++idx) {
+        auto* item = topProtocolItem->child(idx);
+        assert(item != nullptr);
+        if (item->text(0) != RawDataStr) {
+            continue;
+        }
+
+        if (m_ui.m_protocolsTreeWidget->currentItem() != item) {
+            m_ui.m_protocolsTreeWidget->setCurrentItem(item);
+        }
+        return true;
+    }
+
+    return false;
+}
+
 void ProtocolsStackWidget::newItemSelected()
 {
     assert(m_ui.m_protocolsTreeWidget != nullptr);
@@ -38,6 +38,7 @@ public:
     void clear();
     bool isAppMessageSelected();
     bool isExtraInfoSelected();
+    bool selectRawData();
 
 signals:
     void sigMessageSelected(ToolsMessagePtr msg, bool editEnabled);
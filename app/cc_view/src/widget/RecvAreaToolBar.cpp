@@ -23,6 +23,7 @@
 
 #include <QtCore/QObject>
 #include <QtGui/QIcon>
+#include <QtWidgets/QLineEdit>
 
 #include <cassert>
 
@@ -34,6 +35,12 @@ namespace
 
 const QString StartTooltip("Start Reception");
 const QString StopTooltip("Stop Reception");
+const QString QueryTooltip(
+    "Query on the message fields, e.g. \"Msg.field > 10 && name ~= \"list\"\".\n"
+    "Applied together with the filter, used by find next/previous.");
+const QString DataPatternTooltip(
+    "Hex bytes to find in the raw data of the messages, e.g. \"01 ?? a? ff\".\n"
+    "The '?' character matches any nibble, used by find next/previous.");
 
 QAction* createStartButton(QToolBar& bar)
 {
@@ -111,6 +118,26 @@ QAction* createEditFilterButton(QToolBar& bar)
     return action;
 }
 
+QAction* createFindPrevButton(QToolBar& bar)
+{
+    auto* action = bar.addAction(icon::up(), "Find Previous Matching Message");
+    QObject::connect(
+        action, &QAction::triggered,
+        GuiAppMgr::instance(), &GuiAppMgr::recvFindPrevClicked);
+    ShortcutMgr::instanceRef().updateShortcut(*action, ShortcutMgr::Key_FindPrev);
+    return action;
+}
+
+QAction* createFindNextButton(QToolBar& bar)
+{
+    auto* action = bar.addAction(icon::down(), "Find Next Matching Message");
+    QObject::connect(
+        action, &QAction::triggered,
+        GuiAppMgr::instance(), &GuiAppMgr::recvFindNextClicked);
+    ShortcutMgr::instanceRef().updateShortcut(*action, ShortcutMgr::Key_FindNext);
+    return action;
+}
+
 QAction* createApplyFilter(QToolBar& bar)
 {
     auto guiAppMgr = GuiAppMgr::instance();
@@ -173,6 +200,10 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     m_deleteButton(createDeleteButton(*this)),
     m_clearButton(createClearButton(*this)),
     m_editFilterButton(createEditFilterButton(*this)),
+    m_findPrevButton(createFindPrevButton(*this)),
+    m_findNextButton(createFindNextButton(*this)),
+    m_queryEdit(new QLineEdit()),
+    m_dataPatternEdit(new QLineEdit()),
     m_applyFilterButton(createApplyFilter(*this)),
     m_showGarbageButton(createShowGarbage(*this)),
     m_showRecvButton(createShowReceived(*this)),
@@ -181,6 +212,29 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     m_sendState(GuiAppMgr::instance()->sendState()),
     m_activeState(GuiAppMgr::instance()->getActivityState())
 {
+    m_queryEdit->setPlaceholderText("Query");
+    m_queryEdit->setToolTip(QueryTooltip);
+    m_queryEdit->setClearButtonEnabled(true);
+    insertWidget(m_findPrevButton, m_queryEdit);
+
+    m_dataPatternEdit->setPlaceholderText("Hex Bytes");
+    m_dataPatternEdit->setToolTip(DataPatternTooltip);
+    m_dataPatternEdit->setClearButtonEnabled(true);
+    insertWidget(m_findPrevButton, m_dataPatternEdit);
+
+    connect(
+        m_queryEdit, &QLineEdit::editingFinished,
+        this, &RecvAreaToolBar::queryEditingFinished);
+    connect(
+        m_queryEdit, &QLineEdit::textEdited,
+        this, &RecvAreaToolBar::queryTextEdited);
+    connect(
+        m_dataPatternEdit, &QLineEdit::editingFinished,
+        this, &RecvAreaToolBar::dataPatternEditingFinished);
+    connect(
+        m_dataPatternEdit, &QLineEdit::textEdited,
+        this, &RecvAreaToolBar::dataPatternTextEdited);
+
     insertSeparator(m_applyFilterButton);
     auto empty = new QWidget();
     empty->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
@@ -211,6 +265,10 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
         guiAppMgr, &GuiAppMgr::sigActivityStateChanged,
         this, &RecvAreaToolBar::activeStateChanged);
 
+    connect(
+        guiAppMgr, &GuiAppMgr::sigRecvListModeUpdated,
+        this, &RecvAreaToolBar::recvListModeUpdated);
+
     refresh();
 }
 
@@ -272,6 +330,77 @@ void RecvAreaToolBar::activeStateChanged(int state)
     refresh();
 }
 
+void RecvAreaToolBar::recvListModeUpdated()
+{
+    auto& guiAppMgr = GuiAppMgr::instanceRef();
+    m_applyFilterButton->setChecked(guiAppMgr.recvListApplyFilter());
+    m_showGarbageButton->setChecked(guiAppMgr.recvListShowsGarbage());
+    m_showRecvButton->setChecked(guiAppMgr.recvListShowsReceived());
+    m_showSentButton->setChecked(guiAppMgr.recvListShowsSent());
+}
+
+void RecvAreaToolBar::queryEditingFinished()
+{
+    auto* guiAppMgr = GuiAppMgr::instance();
+    auto expr = m_queryEdit->text().trimmed();
+    if (expr.isEmpty()) {
+        m_queryEdit->setStyleSheet(QString());
+        m_queryEdit->setToolTip(QueryTooltip);
+        guiAppMgr->setRecvListQuery(MsgQuery::Ptr());
+        refresh();
+        return;
+    }
+
+    QString error;
+    auto query = MsgQuery::compile(expr, error);
+    if (!query) {
+        m_queryEdit->setStyleSheet("QLineEdit {color: red}");
+        m_queryEdit->setToolTip(error);
+        return;
+    }
+
+    m_queryEdit->setStyleSheet(QString());
+    m_queryEdit->setToolTip(QueryTooltip);
+    guiAppMgr->setRecvListQuery(std::move(query));
+    refresh();
+}
+
+void RecvAreaToolBar::queryTextEdited([[maybe_unused]] const QString& text)
+{
+    m_queryEdit->setStyleSheet(QString());
+}
+
+void RecvAreaToolBar::dataPatternEditingFinished()
+{
+    auto* guiAppMgr = GuiAppMgr::instance();
+    auto text = m_dataPatternEdit->text().trimmed();
+    if (text.isEmpty()) {
+        m_dataPatternEdit->setStyleSheet(QString());
+        m_dataPatternEdit->setToolTip(DataPatternTooltip);
+        guiAppMgr->setRecvDataPattern(DataPattern::Ptr());
+        refresh();
+        return;
+    }
+
+    QString error;
+    auto pattern = DataPattern::compile(text, error);
+    if (!pattern) {
+        m_dataPatternEdit->setStyleSheet("QLineEdit {color: red}");
+        m_dataPatternEdit->setToolTip(error);
+        return;
+    }
+
+    m_dataPatternEdit->setStyleSheet(QString());
+    m_dataPatternEdit->setToolTip(DataPatternTooltip);
+    guiAppMgr->setRecvDataPattern(std::move(pattern));
+    refresh();
+}
+
+void RecvAreaToolBar::dataPatternTextEdited([[maybe_unused]] const QString& text)
+{
+    m_dataPatternEdit->setStyleSheet(QString());
+}
+
 void RecvAreaToolBar::refresh()
 {
     refreshStartStopButton();
@@ -282,6 +411,7 @@ void RecvAreaToolBar::refresh()
     refreshDeleteButton();
     refreshClearButton();
     refreshEditFilterButton();
+    refreshFindButtons();
 }
 
 void RecvAreaToolBar::refreshStartStopButton()
@@ -393,6 +523,17 @@ void RecvAreaToolBar::refreshEditFilterButton()
     button->setEnabled(enabled);
 }
 
+void RecvAreaToolBar::refreshFindButtons()
+{
+    auto& guiAppMgr = GuiAppMgr::instanceRef();
+    bool enabled =
+        (!listEmpty()) &&
+        (static_cast<bool>(guiAppMgr.getRecvListQuery()) ||
+         static_cast<bool>(guiAppMgr.getRecvDataPattern()));
+    m_findPrevButton->setEnabled(enabled);
+    m_findNextButton->setEnabled(enabled);
+}
+
 bool RecvAreaToolBar::msgSelected() const
 {
     bool result = (0 <= m_selectedIdx);
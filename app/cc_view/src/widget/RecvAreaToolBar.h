@@ -25,6 +25,7 @@
 #include <functional>
 
 class QAction;
+class QLineEdit;
 
 namespace cc_tools_qt
 {
@@ -47,6 +48,11 @@ private slots:
     void recvStateChanged(int state);
     void sendStateChanged(int state);
     void activeStateChanged(int state);
+    void recvListModeUpdated();
+    void queryEditingFinished();
+    void queryTextEdited(const QString& text);
+    void dataPatternEditingFinished();
+    void dataPatternTextEdited(const QString& text);
 
 private:
     void refresh();
@@ -58,6 +64,7 @@ private:
     void refreshDeleteButton();
     void refreshClearButton();
     void refreshEditFilterButton();
+    void refreshFindButtons();
 
     bool msgSelected() const;
     bool listEmpty() const;
@@ -70,6 +77,10 @@ private:
     QAction* m_deleteButton = nullptr;
     QAction* m_clearButton = nullptr;
     QAction* m_editFilterButton = nullptr;
+    QAction* m_findPrevButton = nullptr;
+    QAction* m_findNextButton = nullptr;
+    QLineEdit* m_queryEdit = nullptr;
+    QLineEdit* m_dataPatternEdit = nullptr;
     QAction* m_applyFilterButton = nullptr;
     QAction* m_showGarbageButton = nullptr;
     QAction* m_showRecvButton = nullptr;
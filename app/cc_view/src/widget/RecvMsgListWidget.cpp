@@ -42,6 +42,18 @@ RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
     connect(
         guiMgr, &GuiAppMgr::sigAddRecvMsg,
         this, &RecvMsgListWidget::addMessage);
+    connect(
+        guiMgr, &GuiAppMgr::sigRecvListReset,
+        this, &RecvMsgListWidget::resetMessages);
+    connect(
+        guiMgr, &GuiAppMgr::sigRecvMsgSelected,
+        this, &RecvMsgListWidget::selectMsg);
+    connect(
+        guiMgr, &GuiAppMgr::sigRecvFindMsg,
+        this, &RecvMsgListWidget::findMsg);
+    connect(
+        guiMgr, &GuiAppMgr::sigRecvFoundData,
+        this, &RecvMsgListWidget::selectFoundData);
     connect(
         guiMgr, &GuiAppMgr::sigRecvMsgListSelectOnAddEnabled,
         this, &RecvMsgListWidget::selectOnAdd);
@@ -111,6 +123,11 @@ void RecvMsgListWidget::saveMessagesImpl(const QString& filename)
     MsgFileMgrG::instanceRef().save(ToolsMsgFileMgr::Type::Recv, filename, allMsgs());
 }
 
+void RecvMsgListWidget::dataMatchSelectedImpl(int offset, int length)
+{
+    GuiAppMgr::instanceRef().recvDataMatchSelected(offset, length);
+}
+
 QString RecvMsgListWidget::getTitlePrefix()
 {
     auto* guiAppMgr = GuiAppMgr::instance();
@@ -36,6 +36,7 @@ protected:
     virtual Qt::GlobalColor getItemColourImpl(MsgType type, bool valid) const override;
     virtual QString getTitleImpl() const override;
     virtual void saveMessagesImpl(const QString& filename) override;
+    virtual void dataMatchSelectedImpl(int offset, int length) override;
 
 private:
     static QString getTitlePrefix();
@@ -51,6 +51,10 @@ RightPaneWidget::RightPaneWidget(QWidget* parentObj)
         guiAppMgr, &GuiAppMgr::sigClearDisplayedMsg,
         m_displayWidget, &MessageDisplayWidget::clear);
 
+    connect(
+        guiAppMgr, &GuiAppMgr::sigDisplayDataHighlight,
+        m_displayWidget, &MessageDisplayWidget::highlightData);
+
     connect(
         m_displayWidget, &MessageDisplayWidget::sigMsgUpdated,
         this, &RightPaneWidget::msgUpdated);
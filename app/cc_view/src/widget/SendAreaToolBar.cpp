@@ -22,8 +22,10 @@
 
 #include <QtCore/QObject>
 #include <QtGui/QIcon>
+#include <QtWidgets/QInputDialog>
 
 #include <cassert>
+#include <limits>
 
 namespace cc_tools_qt
 {
@@ -33,6 +35,8 @@ namespace
 
 const QString StartTooltip("Send Selected");
 const QString StartAllTooltip("Send All");
+const QString StartBurstText("Burst");
+const QString StartBurstTooltip("Send All Back-to-Back");
 const QString StopTooltip("Stop Sending");
 
 QAction* createStartButton(QToolBar& bar)
@@ -47,6 +51,13 @@ QAction* createStartAllButton(QToolBar& bar)
     return action;
 }
 
+QAction* createStartBurstButton(QToolBar& bar)
+{
+    auto* action = bar.addAction(StartBurstText);
+    action->setToolTip(StartBurstTooltip);
+    return action;
+}
+
 QAction* createLoadButton(QToolBar& bar)
 {
     auto* action = bar.addAction(icon::upload(), "Load Messages");
@@ -183,6 +194,7 @@ SendAreaToolBar::SendAreaToolBar(QWidget* parentObj)
   : Base(parentObj),
     m_startStopButton(createStartButton(*this)),
     m_startStopAllButton(createStartAllButton(*this)),
+    m_startStopBurstButton(createStartBurstButton(*this)),
     m_loadButton(createLoadButton(*this)),
     m_saveButton(createSaveButton(*this)),
     m_addButton(createAddButton(*this)),
@@ -207,6 +219,10 @@ SendAreaToolBar::SendAreaToolBar(QWidget* parentObj)
         m_startStopAllButton, &QAction::triggered,
         this, &SendAreaToolBar::startStopAllClicked);
 
+    connect(
+        m_startStopBurstButton, &QAction::triggered,
+        this, &SendAreaToolBar::startStopBurstClicked);
+
     auto* guiAppMgr = GuiAppMgr::instance();
     connect(
         guiAppMgr, &GuiAppMgr::sigSendListCountReport,
@@ -283,10 +299,34 @@ void SendAreaToolBar::startStopAllClicked()
     GuiAppMgr::instance()->sendStopClicked();
 }
 
+void SendAreaToolBar::startStopBurstClicked()
+{
+    if (m_state != State::Idle) {
+        assert(m_state == State::SendingBurst);
+        GuiAppMgr::instance()->sendStopClicked();
+        return;
+    }
+
+    bool ok = false;
+    auto count =
+        QInputDialog::getInt(
+            this,
+            tr("Burst Send"),
+            tr("Number of times to send the whole list:"),
+            1, 1, std::numeric_limits<int>::max(), 1, &ok);
+
+    if (!ok) {
+        return;
+    }
+
+    GuiAppMgr::instance()->sendStartBurstClicked(static_cast<unsigned>(count));
+}
+
 void SendAreaToolBar::refresh()
 {
     refreshStartStopButton();
     refreshStartStopAllButton();
+    refreshStartStopBurstButton();
     refreshLoadButton();
     refreshSaveButton();
     refreshAddButtons();
@@ -346,6 +386,29 @@ void SendAreaToolBar::refreshStartStopAllButton()
     ShortcutMgr::instanceRef().updateShortcut(*button, ShortcutMgr::Key_SendAll);
 }
 
+void SendAreaToolBar::refreshStartStopBurstButton()
+{
+    auto* button = m_startStopBurstButton;
+    assert(button);
+    if (m_state == State::SendingBurst) {
+        button->setIcon(icon::stop());
+        button->setText(StopTooltip);
+        button->setToolTip(StopTooltip);
+        button->setEnabled(true);
+        return;
+    }
+
+    button->setIcon(QIcon());
+    button->setText(StartBurstText);
+    button->setToolTip(StartBurstTooltip);
+    bool enabled =
+        (m_activeState == ActivityState::Active) &&
+        (!listEmpty()) &&
+        (m_state == State::Idle);
+
+    button->setEnabled(enabled);
+}
+
 void SendAreaToolBar::refreshLoadButton()
 {
     auto* button = m_loadButton;
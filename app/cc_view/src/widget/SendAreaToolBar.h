@@ -42,11 +42,13 @@ private slots:
     void activeStateChanged(int state);
     void startStopClicked();
     void startStopAllClicked();
+    void startStopBurstClicked();
 
 private:
     void refresh();
     void refreshStartStopButton();
     void refreshStartStopAllButton();
+    void refreshStartStopBurstButton();
     void refreshLoadButton();
     void refreshSaveButton();
     void refreshAddButtons();
@@ -63,6 +65,7 @@ private:
 
     QAction* m_startStopButton = nullptr;
     QAction* m_startStopAllButton = nullptr;
+    QAction* m_startStopBurstButton = nullptr;
     QAction* m_loadButton = nullptr;
     QAction* m_saveButton = nullptr;
     QAction* m_addButton = nullptr;
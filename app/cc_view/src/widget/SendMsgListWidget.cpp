@@ -133,7 +133,7 @@ void SendMsgListWidget::stateChangedImpl(int state)
         return;
     }
 
-    assert(m_state == State::SendingAll);
+    assert((m_state == State::SendingAll) || (m_state == State::SendingBurst));
     auto allMsgsList = allMsgs();
     assert(!allMsgsList.empty());
     GuiAppMgr::instanceRef().sendMessages(std::move(allMsgsList));
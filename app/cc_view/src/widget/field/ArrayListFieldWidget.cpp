@@ -68,6 +68,12 @@ void ArrayListElementWidget::setNameSuffix(const QString& value)
     m_fieldWidget->setNameSuffix(value);
 }
 
+bool ArrayListElementWidget::rebind(const FieldWidget::SharedFieldPtr& field)
+{
+    assert(m_fieldWidget != nullptr);
+    return m_fieldWidget->rebind(field);
+}
+
 void ArrayListElementWidget::updateUi()
 {
     bool deleteButtonVisible = m_editEnabled && m_deletable;
@@ -137,6 +143,28 @@ void ArrayListFieldWidget::editEnabledUpdatedImpl()
     updateUi();
 }
 
+bool ArrayListFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    auto& memberFields = m_fieldPtr->getMembers();
+    bool membersRebound = (memberFields.size() == m_elements.size());
+    for (auto idx = 0U; membersRebound && (idx < m_elements.size()); ++idx) {
+        membersRebound = m_elements[idx]->rebind(memberFieldPtr(m_fieldPtr, *memberFields[idx]));
+    }
+
+    if (!membersRebound) {
+        // Different number of elements, recreate them
+        refreshImpl();
+        return true;
+    }
+
+    refreshInternal();
+    return true;
+}
+
 void ArrayListFieldWidget::dataFieldUpdated()
 {
     if (!m_fieldPtr->canWrite()) {
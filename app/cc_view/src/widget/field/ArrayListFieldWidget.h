@@ -46,6 +46,7 @@ public:
     void setEditEnabled(bool enabled);
     void setDeletable(bool deletable);
     void setNameSuffix(const QString& value);
+    bool rebind(const FieldWidget::SharedFieldPtr& field);
 
 signals:
     void sigFieldUpdated();
@@ -66,7 +67,7 @@ class ArrayListFieldWidget : public FieldWidget
     typedef FieldWidget Base;
 public:
     using Field = field::ToolsArrayListField;
-    using FieldPtr = field::ToolsArrayListFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsArrayListField>;
     typedef std::function<std::vector<FieldWidgetPtr> (Field&)> CreateMissingDataFieldsFunc;
 
     explicit ArrayListFieldWidget(
@@ -87,6 +88,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void dataFieldUpdated();
@@ -17,6 +17,9 @@
 
 #include "ArrayListRawDataFieldWidget.h"
 
+#include <QtGui/QTextCursor>
+#include <QtWidgets/QTextEdit>
+
 #include <algorithm>
 #include <cassert>
 #include <limits>
@@ -114,6 +117,39 @@ void ArrayListRawDataFieldWidget::editEnabledUpdatedImpl()
     }
 }
 
+void ArrayListRawDataFieldWidget::highlightDataImpl(int offset, int length)
+{
+    if (m_fieldPtr->isTruncated()) {
+        m_fieldPtr->setForcedShowAll(true);
+        refresh();
+    }
+
+    // Every byte is displayed as 2 hex characters
+    auto* textEdit = m_ui.m_valuePlainTextEdit;
+    QTextEdit::ExtraSelection selection;
+    selection.format.setBackground(Qt::yellow);
+    selection.cursor = QTextCursor(textEdit->document());
+    selection.cursor.setPosition(offset * 2);
+    selection.cursor.setPosition((offset + length) * 2, QTextCursor::KeepAnchor);
+    textEdit->setExtraSelections(QList<QTextEdit::ExtraSelection>() << selection);
+
+    auto curs = textEdit->textCursor();
+    curs.setPosition(offset * 2);
+    textEdit->setTextCursor(curs);
+    textEdit->ensureCursorVisible();
+}
+
+bool ArrayListRawDataFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    m_ui.m_valuePlainTextEdit->setExtraSelections(QList<QTextEdit::ExtraSelection>());
+    refresh();
+    return true;
+}
+
 void ArrayListRawDataFieldWidget::valueChanged()
 {
     auto str = m_ui.m_valuePlainTextEdit->toPlainText();
@@ -30,7 +30,7 @@ class ArrayListRawDataFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsRawDataFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsRawDataField>;
 
     explicit ArrayListRawDataFieldWidget(
         FieldPtr&& fieldPtr,
@@ -42,6 +42,8 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual void highlightDataImpl(int offset, int length) override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void valueChanged();
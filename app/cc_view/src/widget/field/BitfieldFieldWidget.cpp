@@ -94,6 +94,27 @@ void BitfieldFieldWidget::editEnabledUpdatedImpl()
     }
 }
 
+bool BitfieldFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    auto& memberFields = m_fieldPtr->getMembers();
+    if (memberFields.size() != m_members.size()) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx < m_members.size(); ++idx) {
+        if (!m_members[idx]->rebind(memberFieldPtr(m_fieldPtr, *memberFields[idx]))) {
+            return false;
+        }
+    }
+
+    refreshInternal();
+    return true;
+}
+
 void BitfieldFieldWidget::serialisedValueUpdated(const QString& value)
 {
     handleNumericSerialisedValueUpdate(value, *m_fieldPtr);
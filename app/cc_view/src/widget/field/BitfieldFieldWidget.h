@@ -32,7 +32,7 @@ class BitfieldFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsBitfieldFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsBitfieldField>;
 
     explicit BitfieldFieldWidget(
         FieldPtr&& fieldPtr,
@@ -46,6 +46,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void serialisedValueUpdated(const QString& value);
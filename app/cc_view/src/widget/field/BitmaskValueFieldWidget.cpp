@@ -98,6 +98,16 @@ void BitmaskValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
+bool BitmaskValueFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    refresh();
+    return true;
+}
+
 void BitmaskValueFieldWidget::serialisedValueUpdated(const QString& value)
 {
     handleNumericSerialisedValueUpdate(value, *m_fieldPtr);
@@ -33,7 +33,7 @@ class BitmaskValueFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsBitmaskFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsBitmaskField>;
 
     explicit BitmaskValueFieldWidget(
         FieldPtr&& fieldPtr,
@@ -45,6 +45,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void serialisedValueUpdated(const QString& value);
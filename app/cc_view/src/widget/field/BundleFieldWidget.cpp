@@ -83,6 +83,26 @@ void BundleFieldWidget::editEnabledUpdatedImpl()
     }
 }
 
+bool BundleFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    auto& memberFields = m_fieldPtr->getMembers();
+    if (memberFields.size() != m_members.size()) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx < m_members.size(); ++idx) {
+        if (!m_members[idx]->rebind(memberFieldPtr(m_fieldPtr, *memberFields[idx]))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void BundleFieldWidget::memberFieldUpdated()
 {
     auto senderIter = std::find(m_members.begin(), m_members.end(), qobject_cast<FieldWidget*>(sender()));
@@ -37,7 +37,7 @@ class BundleFieldWidget : public FieldWidget
 public:
 
     using Field = field::ToolsBundleField;
-    using FieldPtr = field::ToolsBundleFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsBundleField>;
 
     explicit BundleFieldWidget(
         FieldPtr fieldPtr,
@@ -51,6 +51,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void memberFieldUpdated();
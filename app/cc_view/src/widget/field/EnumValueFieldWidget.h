@@ -30,7 +30,7 @@ class EnumValueFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsEnumFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsEnumField>;
 
     explicit EnumValueFieldWidget(
         FieldPtr&& fieldPtr,
@@ -42,6 +42,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void serialisedValueUpdated(const QString& value);
@@ -61,6 +61,18 @@ void FieldWidget::setNameSuffix(const QString& value)
     nameSuffixUpdatedImpl();
 }
 
+bool FieldWidget::rebind(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindImpl(fieldParam)) {
+        return false;
+    }
+
+    // The name, serialisation visibility and read only state
+    // are reported by the new wrapper.
+    commonConstruct();
+    return true;
+}
+
 void FieldWidget::refresh()
 {
     refreshImpl();
@@ -72,6 +84,11 @@ void FieldWidget::setEditEnabled(bool enabled)
     editEnabledUpdatedImpl();
 }
 
+void FieldWidget::highlightData(int offset, int length)
+{
+    highlightDataImpl(offset, length);
+}
+
 void FieldWidget::emitFieldUpdated()
 {
     emit sigFieldUpdated();
@@ -165,6 +182,15 @@ void FieldWidget::nameSuffixUpdatedImpl()
 {
 }
 
+void FieldWidget::highlightDataImpl([[maybe_unused]] int offset, [[maybe_unused]] int length)
+{
+}
+
+bool FieldWidget::rebindImpl([[maybe_unused]] const SharedFieldPtr& fieldParam)
+{
+    return false;
+}
+
 void FieldWidget::performNameLabelUpdate()
 {
     if (m_nameLabel == nullptr) {
@@ -25,6 +25,7 @@
 #include <cassert>
 #include <functional>
 #include <memory>
+#include <typeinfo>
 
 class QLineEdit;
 class QLabel;
@@ -39,6 +40,8 @@ class FieldWidget : public QWidget
     Q_OBJECT
     typedef QWidget Base;
 public:
+    using SharedFieldPtr = std::shared_ptr<ToolsField>;
+
     FieldWidget(QWidget* parentObj = nullptr);
     ~FieldWidget() noexcept = default;
 
@@ -54,9 +57,15 @@ public:
         return fieldImpl();
     }
 
+    /// @brief Bind the widget to the field of another message object of the same type.
+    /// @details The widget shares the provided wrapper, the displayed values are updated in place.
+    /// @return @b false if the field is of different type, the widget needs to be recreated.
+    bool rebind(const SharedFieldPtr& fieldParam);
+
 public slots:
     void refresh();
     void setEditEnabled(bool enabled);
+    void highlightData(int offset, int length);
 
 signals:
     void sigFieldUpdated();
@@ -120,10 +129,37 @@ protected:
 
     void commonConstruct();
 
+    template <typename TFieldPtr>
+    static bool rebindFieldPtr(TFieldPtr& fieldPtr, const SharedFieldPtr& fieldParam)
+    {
+        // The wrapping classes are specific to the actual field types,
+        // i.e. the same wrapping class means the same structure.
+        assert(fieldPtr);
+        assert(fieldParam);
+        auto& currField = *fieldPtr;
+        if (typeid(currField) != typeid(*fieldParam)) {
+            return false;
+        }
+
+        using FieldType = typename TFieldPtr::element_type;
+        fieldPtr = std::static_pointer_cast<FieldType>(fieldParam);
+        return true;
+    }
+
+    // The member wrappers are owned by the wrapper of the outer field,
+    // the returned pointer keeps the latter alive.
+    template <typename TFieldPtr>
+    static SharedFieldPtr memberFieldPtr(const TFieldPtr& ownerPtr, ToolsField& member)
+    {
+        return SharedFieldPtr(ownerPtr, &member);
+    }
+
     virtual ToolsField& fieldImpl() = 0;
     virtual void refreshImpl() = 0;
     virtual void editEnabledUpdatedImpl();
     virtual void nameSuffixUpdatedImpl();
+    virtual void highlightDataImpl(int offset, int length);
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam);
 
 private:
     void performNameLabelUpdate();
@@ -112,5 +112,15 @@ void IntValueFieldWidget::nameSuffixUpdatedImpl()
     }
 }
 
+bool IntValueFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    // The kind of the child widget depends only on the field type
+    if (!m_childWidget) {
+        return false;
+    }
+
+    return m_childWidget->rebind(fieldParam);
+}
+
 }  // namespace cc_tools_qt
 
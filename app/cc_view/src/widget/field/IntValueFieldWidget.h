@@ -30,7 +30,7 @@ class IntValueFieldWidget : public FieldWidget
 {
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsIntFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsIntField>;
 
     explicit IntValueFieldWidget(
         FieldPtr fieldPtr,
@@ -43,6 +43,7 @@ protected:
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
     virtual void nameSuffixUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private:
     using FieldType = FieldPtr::element_type;
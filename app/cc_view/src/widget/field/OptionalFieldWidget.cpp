@@ -81,6 +81,25 @@ void OptionalFieldWidget::editEnabledUpdatedImpl()
     m_field->setEditEnabled(isEditEnabled());
 }
 
+bool OptionalFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    if (m_fieldPtr->getMode() == Mode::Tentative) {
+        m_fieldPtr->setMode(Mode::Missing);
+    }
+
+    assert(m_field != nullptr);
+    if (!m_field->rebind(memberFieldPtr(m_fieldPtr, m_fieldPtr->getField()))) {
+        return false;
+    }
+
+    refreshInternal();
+    return true;
+}
+
 void OptionalFieldWidget::fieldUpdated()
 {
     if (!m_fieldPtr->canWrite()) {
@@ -32,7 +32,7 @@ class OptionalFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsOptionalFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsOptionalField>;
 
     explicit OptionalFieldWidget(
         FieldPtr fieldPtr,
@@ -46,6 +46,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void fieldUpdated();
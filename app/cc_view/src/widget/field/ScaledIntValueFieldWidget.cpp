@@ -103,6 +103,16 @@ void ScaledIntValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
+bool ScaledIntValueFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    refresh();
+    return true;
+}
+
 void ScaledIntValueFieldWidget::serialisedValueUpdated(const QString& value)
 {
     m_ui.m_valueSpinBox->blockSignals(true);
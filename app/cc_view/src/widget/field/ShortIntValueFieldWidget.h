@@ -31,7 +31,7 @@ class ShortIntValueFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsIntFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsIntField>;
 
     explicit ShortIntValueFieldWidget(
         FieldPtr fieldPtr,
@@ -43,6 +43,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void serialisedValueUpdated(const QString& value);
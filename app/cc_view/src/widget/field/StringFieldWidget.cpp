@@ -81,6 +81,16 @@ void StringFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_valuePlainTextEdit->setReadOnly(readonly);
 }
 
+bool StringFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    refresh();
+    return true;
+}
+
 void StringFieldWidget::stringChanged()
 {
     auto str = m_ui.m_valuePlainTextEdit->toPlainText();
@@ -30,7 +30,7 @@ class StringFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsStringFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsStringField>;
 
     explicit StringFieldWidget(
         FieldPtr&& fieldPtr,
@@ -42,6 +42,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void stringChanged();
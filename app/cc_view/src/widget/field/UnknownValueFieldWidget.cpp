@@ -24,7 +24,7 @@ namespace cc_tools_qt
 {
 
 UnknownValueFieldWidget::UnknownValueFieldWidget(
-    field::ToolsUnknownFieldPtr&& fieldPtr,
+    FieldPtr&& fieldPtr,
     QWidget* parentObj)
   : Base(parentObj),
     m_fieldPtr(std::move(fieldPtr))
@@ -70,6 +70,16 @@ void UnknownValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
+bool UnknownValueFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    refresh();
+    return true;
+}
+
 void UnknownValueFieldWidget::serialisedValueUpdated(const QString& value)
 {
     assert(isEditEnabled());
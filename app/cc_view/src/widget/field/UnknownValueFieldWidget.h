@@ -30,8 +30,10 @@ class UnknownValueFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
+    using FieldPtr = std::shared_ptr<field::ToolsUnknownField>;
+
     explicit UnknownValueFieldWidget(
-        field::ToolsUnknownFieldPtr&& fieldPtr,
+        FieldPtr&& fieldPtr,
         QWidget* parentObj = nullptr);
 
     ~UnknownValueFieldWidget() noexcept;
@@ -40,6 +42,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void serialisedValueUpdated(const QString& value);
@@ -48,7 +51,7 @@ private:
     void setFieldValid(bool valid);
 
     Ui::UnknownValueFieldWidget m_ui;
-    field::ToolsUnknownFieldPtr m_fieldPtr;
+    FieldPtr m_fieldPtr;
 };
 
 }  // namespace cc_tools_qt
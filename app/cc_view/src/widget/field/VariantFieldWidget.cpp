@@ -103,6 +103,35 @@ void VariantFieldWidget::editEnabledUpdatedImpl()
     updateIndexDisplay();
 }
 
+bool VariantFieldWidget::rebindImpl(const SharedFieldPtr& fieldParam)
+{
+    if (!rebindFieldPtr(m_fieldPtr, fieldParam)) {
+        return false;
+    }
+
+    // The member widget is recreated only when the other member is selected
+    auto* currentField = m_fieldPtr->getCurrent();
+    bool memberRebound =
+        (m_member != nullptr) &&
+        (currentField != nullptr) &&
+        m_member->rebind(memberFieldPtr(m_fieldPtr, *currentField));
+
+    if (!memberRebound) {
+        delete m_member;
+        m_member = nullptr;
+
+        if (currentField != nullptr) {
+            createMemberWidget();
+            m_member->setEditEnabled(isEditEnabled());
+        }
+    }
+
+    updateIndexValue();
+    updateMemberCombo();
+    refreshInternal();
+    return true;
+}
+
 void VariantFieldWidget::memberFieldUpdated()
 {
     if (!m_fieldPtr->canWrite()) {
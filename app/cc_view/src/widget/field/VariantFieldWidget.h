@@ -32,7 +32,7 @@ class VariantFieldWidget : public FieldWidget
     Q_OBJECT
     typedef FieldWidget Base;
 public:
-    using FieldPtr = field::ToolsVariantFieldPtr;
+    using FieldPtr = std::shared_ptr<field::ToolsVariantField>;
     using CreateMemberFieldWidgetFunc =
         std::function<FieldWidgetPtr (ToolsField&)>;
 
@@ -49,6 +49,7 @@ protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
     virtual void editEnabledUpdatedImpl() override;
+    virtual bool rebindImpl(const SharedFieldPtr& fieldParam) override;
 
 private slots:
     void memberFieldUpdated();
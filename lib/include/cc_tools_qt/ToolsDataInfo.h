@@ -20,6 +20,7 @@
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/version.h"
 
+#include <QtCore/QString>
 #include <QtCore/QVariant>
 #include <QtCore/QVariantMap>
 
@@ -51,6 +52,7 @@ struct CC_TOOLS_API ToolsDataInfo
     Timestamp m_timestamp; ///< Timestamp when data has been received / sent
     DataSeq m_data; ///< Actual raw data
     PropertiesMap m_extraProperties; ///< Extra properties that can be used by other componets
+    QString m_source; ///< Identifier of the received data stream (e.g. connection), streams are decoded independently
 };
 
 /// @brief Pointer to @ref ToolsDataInfo
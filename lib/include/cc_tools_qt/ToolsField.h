@@ -24,6 +24,7 @@
 #include <QtCore/QString>
 #include <QtCore/QVariant>
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -97,9 +98,23 @@ protected:
     virtual void resetImpl() = 0;
     virtual void membersUpdatedImpl();
 
+    /// @brief Postpone creation of the members until they are accessed.
+    /// @details The @ref createMembersImpl() is invoked on the first
+    ///     access to the members via getMembers(), which can happen on
+    ///     any thread.
+    void invalidateMembers();
+
+    /// @brief Polymorphic lazy creation of the members.
+    /// @details Invoked by getMembers() after invalidateMembers(),
+    ///     expected to call setMembers().
+    virtual void createMembersImpl();
+
 private:
+    void ensureMembers() const;
+
     Members m_members;
-    QVariantMap m_props;
+    unsigned m_forcedFlags = 0U;
+    mutable std::atomic<bool> m_membersPending;
 };
 
 using ToolsFieldPtr = ToolsField::Ptr;
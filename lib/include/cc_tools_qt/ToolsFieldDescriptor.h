@@ -0,0 +1,113 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+class ToolsMessage;
+
+/// @brief Flat description of a single payload field of a message type.
+/// @details The descriptors are generated per message type from the types
+///     of the protocol fields (see @ref ToolsMessage::fieldDescriptors()).
+///     The members of the bundles and bitfields are listed right after their
+///     parent, while the lists, variants and optionals are described as a
+///     single entry. Allows reading the field values without creating the
+///     @ref ToolsField wrappers.
+/// @headerfile cc_tools_qt/ToolsFieldDescriptor.h
+struct ToolsFieldDescriptor
+{
+    /// @brief Kind of the field
+    enum class Kind
+    {
+        Int, ///< Integral value, reported as qlonglong
+        UnsignedLong, ///< Big unsigned value, reported as qulonglong
+        Bitmask, ///< Bitmask, reported as qulonglong
+        Enum, ///< Enum, reported as qlonglong
+        String, ///< String, reported as QString
+        Bitfield, ///< Bitfield, values are reported by the members
+        Optional, ///< Optional, reports the value of the wrapped field when it exists
+        Bundle, ///< Bundle, values are reported by the members
+        RawData, ///< Raw data, reported as QByteArray
+        ArrayList, ///< List of fields, reports number of elements
+        Float, ///< Floating point value, reported as double
+        Variant, ///< Variant, reports index of the current member
+        Unknown, ///< Unknown field, reports invalid value
+        NumOfValues ///< Number of available values
+    };
+
+    /// @brief Function reading the value of the field from the message object
+    using ValueFunc = QVariant (*)(const ToolsMessage& msg);
+
+    /// @brief View of the bytes stored in the raw data field
+    struct DataView
+    {
+        const std::uint8_t* m_data = nullptr; ///< Pointer to the first byte
+        std::size_t m_size = 0U; ///< Number of bytes
+    };
+
+    /// @brief Function accessing the bytes of the raw data field in place
+    using DataFunc = DataView (*)(const ToolsMessage& msg);
+
+    /// @brief Value of @ref m_offset when it's not known at compile time
+    static constexpr std::size_t NoOffset = std::numeric_limits<std::size_t>::max();
+
+    /// @brief Dot separated path, e.g. "field.member"
+    QString m_path;
+
+    /// @brief Name of the field
+    const char* m_name = nullptr;
+
+    /// @brief Kind of the field
+    Kind m_kind = Kind::Unknown;
+
+    /// @brief Index of the parent descriptor, -1 for the top level fields
+    int m_parent = -1;
+
+    /// @brief Offset of the field in the serialized payload, @ref NoOffset if
+    ///     it depends on the contents of the preceding fields.
+    std::size_t m_offset = NoOffset;
+
+    /// @brief Minimal serialization length
+    std::size_t m_minLength = 0U;
+
+    /// @brief Maximal serialization length
+    std::size_t m_maxLength = 0U;
+
+    /// @brief Read the value of the field.
+    /// @details Must be invoked only with the message object of the type
+    ///     that reported the descriptor.
+    ValueFunc m_valueFunc = nullptr;
+
+    /// @brief Access the bytes of the @ref Kind::RawData field without copying.
+    /// @details @b nullptr for other kinds of fields. The reported view is
+    ///     valid until the field is modified or the message object is destructed.
+    DataFunc m_dataFunc = nullptr;
+};
+
+using ToolsFieldDescriptorsList = std::vector<ToolsFieldDescriptor>;
+
+}  // namespace cc_tools_qt
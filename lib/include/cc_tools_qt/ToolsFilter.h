@@ -40,6 +40,9 @@ class CC_TOOLS_API ToolsFilter : public QObject
 {
     Q_OBJECT
 public:
+    /// @brief Sequence of data buffers processed in a single batch.
+    using DataInfosSeq = std::vector<ToolsDataInfoPtr>;
+
     /// @brief Constructor
     ToolsFilter();
 
@@ -78,6 +81,26 @@ public:
     ///     chain
     QList<ToolsDataInfoPtr> sendData(ToolsDataInfoPtr dataPtr);
 
+    /// @brief Process batch of received data
+    /// @details Batch equivalent of the recvData(). Invokes virtual
+    ///     recvDataListImpl(), which can be overridden by the derived class.
+    /// @param[in, out] data Incoming data from I/O socket or other filter
+    ///     down the chain. The buffers may be modified in place. The sequence
+    ///     is left empty on return.
+    /// @param[out] out Data to forward to the protocol or to other filter up the
+    ///     chain. Expected to be empty on invocation.
+    void recvDataList(DataInfosSeq& data, DataInfosSeq& out);
+
+    /// @brief Process batch of outgoing data
+    /// @details Batch equivalent of the sendData(). Invokes virtual
+    ///     sendDataListImpl(), which can be overridden by the derived class.
+    /// @param[in, out] data Outgoing data generated by the protocol or
+    ///     other filter up the chain. The buffers may be modified in place.
+    ///     The sequence is left empty on return.
+    /// @param[out] out Data to forward to the I/O socket or other filter down the
+    ///     chain. Expected to be empty on invocation.
+    void sendDataList(DataInfosSeq& data, DataInfosSeq& out);
+
     /// @brief Make the filter aware about socket connection status
     /// @param[in] connected Socket connection status.
     void socketConnectionReport(bool connected);
@@ -93,6 +116,13 @@ public:
     /// @param[in] level Debug level. If @b 0, debug output is disabled
     void setDebugOutputLevel(unsigned level = 0U);
 
+    /// @brief Check the received data can be processed on a separate thread.
+    /// @details The driving application is allowed to invoke @ref recvDataList()
+    ///     on a dedicated thread, concurrently with the rest of the filter's
+    ///     functionality, only when the filter reports this capability.
+    ///     See @ref setConcurrentRecvSupported().
+    bool isConcurrentRecvSupported() const;
+
 signals:
     /// @brief Signal used to report extra data to send
     /// @param[in] data Data to send.
@@ -128,6 +158,25 @@ protected:
     ///     class. Default implementation is pass-through of data.
     virtual QList<ToolsDataInfoPtr> sendDataImpl(ToolsDataInfoPtr dataPtr);
 
+    /// @brief Polymorphic batch processing of incoming data.
+    /// @details Invoked by recvData() and recvDataList(). The buffers in @b data
+    ///     can be transformed in place and/or replaced by new ones. All the
+    ///     buffers to forward need to be placed into @b out, which is empty on
+    ///     invocation. A pass-through or in-place transformation doesn't need
+    ///     any allocation: just swap @b data and @b out. Default
+    ///     implementation invokes recvDataImpl() for every buffer.
+    /// @param[in, out] data Incoming data.
+    /// @param[out] out Data to forward.
+    virtual void recvDataListImpl(DataInfosSeq& data, DataInfosSeq& out);
+
+    /// @brief Polymorphic batch processing of outgoing data.
+    /// @details Invoked by sendData() and sendDataList(). The same rules as
+    ///     for recvDataListImpl() apply. Default implementation invokes
+    ///     sendDataImpl() for every buffer.
+    /// @param[in, out] data Outgoing data.
+    /// @param[out] out Data to forward.
+    virtual void sendDataListImpl(DataInfosSeq& data, DataInfosSeq& out);
+
     /// @brief Polymorphic processing of the socket connection report
     /// @param[in] connected Socket connection status
     virtual void socketConnectionReportImpl(bool connected);
@@ -146,6 +195,14 @@ protected:
     /// @brief Get current debug output level
     unsigned getDebugOutputLevel() const;
 
+    /// @brief Declare the receive processing thread safe.
+    /// @details Expected to be invoked by the derived class, which guarantees
+    ///     that its recvDataListImpl() (or recvDataImpl()) can run on
+    ///     a separate thread concurrently with all the other member functions.
+    ///     Not supported by default.
+    /// @param[in] supported Capability value.
+    void setConcurrentRecvSupported(bool supported = true);
+
 protected slots:
     /// @brief Report new data to send generated by the filter itself.
     /// @details This function needs to be invoked by the derived class when
@@ -43,6 +43,7 @@ public:
     ToolsMessagesList createAllMessages();
     ToolsMessagePtr createMessage(const QString& idAsString, unsigned idx);
     DataSeq writeProtMsg(const void* protInterface);
+    void clearRecycledMessages();
 
 protected:
     ToolsFrame() = default;
@@ -55,6 +56,7 @@ protected:
     virtual ToolsMessagesList createAllMessagesImpl() = 0;
     virtual ToolsMessagePtr createMessageImpl(const QString& idAsString, unsigned idx) = 0;
     virtual DataSeq writeProtMsgImpl(const void* protInterface) = 0;
+    virtual void clearRecycledMessagesImpl() = 0;
 };
 
 using ToolsFramePtr = std::unique_ptr<ToolsFrame>;
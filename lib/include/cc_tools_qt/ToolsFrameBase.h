@@ -19,12 +19,14 @@
 
 #include "cc_tools_qt/ToolsExtraInfoMessage.h"
 #include "cc_tools_qt/ToolsInvalidMessage.h"
+#include "cc_tools_qt/ToolsMsgPool.h"
 #include "cc_tools_qt/ToolsRawDataMessage.h"
 #include "cc_tools_qt/property/message.h"
 
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QByteArray>
+#include <QtCore/QHash>
 
 #include <algorithm>
 #include <cassert>
@@ -54,38 +56,50 @@ public:
 
     using ProtFrame = TProtFrame;
 
-    ToolsFrameBase() = default;
+    ToolsFrameBase() :
+        m_rawDataMsgsPool(
+            []()
+            {
+                return ToolsMessage::Ptr(new RawDataMsg());
+            })
+    {
+    }
 
 protected:
     virtual ToolsMessagesList readDataImpl(const ToolsDataInfo& dataInfo, bool final) override
     {
-        m_inData.reserve(m_inData.size() + dataInfo.m_data.size());
-        m_inData.insert(m_inData.end(), dataInfo.m_data.begin(), dataInfo.m_data.end());
+        // Data of different sources (e.g. connections) must not be mixed
+        auto& context = m_contexts[dataInfo.m_source];
+        auto& inData = context.m_inData;
+        auto& garbage = context.m_garbage;
+
+        inData.reserve(inData.size() + dataInfo.m_data.size());
+        inData.insert(inData.end(), dataInfo.m_data.begin(), dataInfo.m_data.end());
 
         ToolsMessagesList allMsgs;
         std::size_t consumed = 0U;
 
         auto checkGarbageFunc =
-            [this, &allMsgs]()
+            [this, &allMsgs, &garbage]()
             {
-                if (m_garbage.empty()) {
+                if (garbage.empty()) {
                     return;
                 }
 
                 ToolsMessagePtr invalidMsgPtr(new InvalidMsg);
-                updateRawDataInternal(m_garbage, *invalidMsgPtr);
+                updateRawDataInternal(garbage, *invalidMsgPtr);
                 allMsgs.push_back(std::move(invalidMsgPtr));
-                m_garbage.clear();
+                garbage.clear();
             };
 
         using ProtMsgPtr = typename ProtFrame::MsgPtr;
         using ReadIter = typename ProtInterface::ReadIterator;
-        while (consumed < m_inData.size()) {
+        while (consumed < inData.size()) {
             ProtMsgPtr msgPtr;
 
-            ReadIter readIterBeg = m_inData.data() + consumed;
+            ReadIter readIterBeg = inData.data() + consumed;
             ReadIter readIter = readIterBeg;
-            auto remLen = m_inData.size() - consumed;
+            auto remLen = inData.size() - consumed;
             assert(0U < remLen);
 
             qlonglong msgId = 0;
@@ -109,9 +123,9 @@ protected:
             }
 
             if (es != comms::ErrorStatus::Success) {
-                m_garbage.push_back(*readIterBeg);
+                garbage.push_back(*readIterBeg);
                 static constexpr std::size_t GarbageLimit = 512;
-                if (GarbageLimit <= m_garbage.size()) {
+                if (GarbageLimit <= garbage.size()) {
                     checkGarbageFunc();
                 }
 
@@ -124,13 +138,14 @@ protected:
             auto diff = static_cast<std::size_t>(std::distance(readIterBeg, readIter));
             consumed += diff;
 
-            auto toolsMsg = m_factory.createMessage(msgId, static_cast<unsigned>(idx));
+            // Recycled message, the contents are assigned below
+            auto toolsMsg = m_factory.acquireMessage(msgId, static_cast<unsigned>(idx));
             if (!toolsMsg) {
                 [[maybe_unused]] static constexpr bool Protocol_and_Tools_Frames_Out_of_Sync = false;
                 assert(Protocol_and_Tools_Frames_Out_of_Sync);
 
-                m_garbage.reserve(m_garbage.size() + diff);
-                m_garbage.insert(m_garbage.end(), readIterBeg, readIter);
+                garbage.reserve(garbage.size() + diff);
+                garbage.insert(garbage.end(), readIterBeg, readIter);
                 checkGarbageFunc();
                 continue;
             }
@@ -145,14 +160,16 @@ protected:
 
         static_cast<void>(final);
 
-        assert(consumed <= m_inData.size());
-        m_inData.erase(m_inData.begin(), m_inData.begin() + consumed);
+        assert(consumed <= inData.size());
+        inData.erase(inData.begin(), inData.begin() + consumed);
 
-        if (final && (!m_inData.empty())) {
-            m_garbage.reserve(m_garbage.size() + m_inData.size());
-            m_garbage.insert(m_garbage.end(), m_inData.begin(), m_inData.end());
-            m_inData.clear();
+        if (final) {
+            garbage.reserve(garbage.size() + inData.size());
+            garbage.insert(garbage.end(), inData.begin(), inData.end());
             checkGarbageFunc();
+
+            // No more data is expected from the source
+            m_contexts.remove(dataInfo.m_source);
         }
 
         if (!dataInfo.m_extraProperties.isEmpty()) {
@@ -244,6 +261,12 @@ protected:
         return data;
     }
 
+    virtual void clearRecycledMessagesImpl() override
+    {
+        m_factory.clearRecycledMessages();
+        m_rawDataMsgsPool.clear();
+    }
+
 private:
     void updateTransportInternal(const DataSeq& data, ToolsMessage& msg)
     {
@@ -262,7 +285,8 @@ private:
 
     void updateRawDataInternal(const DataSeq& data, ToolsMessage& msg)
     {
-        ToolsMessagePtr rawDataMsg(new RawDataMsg);
+        // The single raw data field is fully overwritten by the decoding
+        auto rawDataMsg = m_rawDataMsgsPool.acquire(false);
         if (!rawDataMsg->decodeData(data)) {
             std::cerr << "ERROR: Failed to decode raw data message: " << std::hex;
             std::copy(data.begin(), data.end(), std::ostream_iterator<unsigned>(std::cerr, " "));
@@ -290,10 +314,18 @@ private:
         property::message::ToolsMsgExtraInfoMsg().setTo(std::move(extraInfoMsg), msg);
     }
 
+    struct DecodeContext
+    {
+        DataSeq m_inData;
+        DataSeq m_garbage;
+    };
+
+    using DecodeContextsMap = QHash<QString, DecodeContext>;
+
     ProtFrame m_frame;
     TMsgFactory m_factory;
-    DataSeq m_inData;
-    DataSeq m_garbage;
+    DecodeContextsMap m_contexts;
+    ToolsMsgPool m_rawDataMsgsPool;
 };
 
 }  // namespace cc_tools_qt
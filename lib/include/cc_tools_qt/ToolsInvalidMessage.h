@@ -87,6 +87,11 @@ protected:
         return 0;
     }
 
+    virtual bool hasIdImpl() const override
+    {
+        return false;
+    }
+
     virtual void resetImpl() override
     {
         [[maybe_unused]] static constexpr bool Must_not_be_called = false;
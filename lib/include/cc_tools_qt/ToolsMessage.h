@@ -19,17 +19,22 @@
 
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/ToolsField.h"
+#include "cc_tools_qt/ToolsFieldDescriptor.h"
 #include "cc_tools_qt/version.h"
 
 #include "comms/ErrorStatus.h"
 
 #include <QtCore/QObject>
+#include <QtCore/QVariant>
 #include <QtCore/QVariantList>
 #include <QtCore/QVariantMap>
 
+#include <atomic>
 #include <cstdint>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace cc_tools_qt
@@ -52,6 +57,11 @@ public:
 
     using FieldsList = std::vector<ToolsFieldPtr>;
 
+    /// @brief Pointer to the list of field wrappers shared between its users
+    using FieldsListPtr = std::shared_ptr<FieldsList>;
+
+    using FieldDescriptorsList = ToolsFieldDescriptorsList;
+
     /// @brief Type of the message
     enum class Type {
         Invalid, ///< Invalid type
@@ -80,6 +90,11 @@ public:
 
     qlonglong numericId() const;
 
+    /// @brief Check whether the message has a valid ID.
+    /// @details Invokes hasIdImpl(). Unlike checking the idAsString()
+    ///     result, doesn't allocate any memory.
+    bool hasId() const;
+
     /// @brief Reset message contents to default constructed values
     void reset();
 
@@ -106,9 +121,73 @@ public:
 
     DataSeq encodeFramed(ToolsFrame& frame) const;
 
+    /// @brief Create wrappers of the transport fields.
+    /// @details Every invocation creates new set of wrappers using the
+    ///     transportFieldsImpl().
     FieldsList transportFields();
+
+    /// @brief Create wrappers of the payload fields.
+    /// @details Every invocation creates new set of wrappers using the
+    ///     payloadFieldsImpl().
     FieldsList payloadFields();
 
+    /// @brief Get cached wrappers of the transport fields.
+    /// @details The wrappers are created by transportFields() on the first
+    ///     invocation and shared by all the callers until invalidateFields()
+    ///     is invoked. The elements of the array lists are wrapped on the
+    ///     first access to them. Can be invoked from any thread. The previously
+    ///     returned list stays alive after the invalidation, but mustn't be
+    ///     used to access the message fields any more. The code modifying the
+    ///     structure of the fields via the shared wrappers is expected to
+    ///     invoke invalidateFields() afterwards.
+    FieldsListPtr cachedTransportFields();
+
+    /// @brief Get cached wrappers of the payload fields.
+    /// @details Similar to cachedTransportFields(), but the wrappers are
+    ///     created by payloadFields().
+    FieldsListPtr cachedPayloadFields();
+
+    /// @brief Get version of the fields structure.
+    /// @details Allows the code keeping the field wrappers to detect
+    ///     that the wrappers cannot be reused any more.
+    unsigned fieldsVersion() const;
+
+    /// @brief Report modification of the fields structure.
+    /// @details Updates the value reported by fieldsVersion() and drops
+    ///     the cached wrappers.
+    ///     Invoked automatically by the reset(), assign(), decodeData(),
+    ///     assignProtMessage(), and refreshMsg() (when reported change).
+    ///     Needs to be invoked explicitly when the structure of the message
+    ///     fields (size of the lists, current member of the variants, etc...)
+    ///     is modified directly.
+    void invalidateFields();
+
+    /// @brief Get flat descriptors of the payload fields.
+    /// @details The descriptors are shared by all the message objects of the
+    ///     same type and allow reading the field values without creating
+    ///     the field wrappers. Invokes fieldDescriptorsImpl().
+    const FieldDescriptorsList& fieldDescriptors() const;
+
+    /// @brief Get value of the message property.
+    /// @details The properties (see @ref cc_tools_qt::property::message)
+    ///     are stored by the message object itself rather than as the
+    ///     QObject dynamic properties, to allow their cheap removal
+    ///     without any events being sent.
+    /// @param[in] name Name of the property, expected to have static
+    ///     storage duration.
+    /// @return Invalid QVariant if the property doesn't exist.
+    QVariant toolsProperty(const char* name) const;
+
+    /// @brief Update value of the message property.
+    /// @details Invalid @b value removes the property.
+    /// @param[in] name Name of the property, expected to have static
+    ///     storage duration.
+    /// @param[in] value Value of the property.
+    void setToolsProperty(const char* name, QVariant&& value);
+
+    /// @brief Remove all the message properties.
+    void clearToolsProperties();
+
 protected:
 
     ToolsMessage();
@@ -129,6 +208,12 @@ protected:
     /// @details Invoked by idAsString().
     virtual QString idAsStringImpl() const;
 
+    /// @brief Polymophic check of the message having a valid ID.
+    /// @details Invoked by hasId(), default implementation returns true.
+    ///     The messages overriding it to return false are expected to
+    ///     report empty idAsString().
+    virtual bool hasIdImpl() const;
+
     /// @brief Polymorphic reset functionality.
     /// @details Invoked by reset().
     virtual void resetImpl() = 0;
@@ -157,6 +242,22 @@ protected:
 
     virtual FieldsList transportFieldsImpl() = 0;
     virtual FieldsList payloadFieldsImpl() = 0;
+
+    /// @brief Polymorphic retrieval of the payload fields descriptors.
+    /// @details Invoked by fieldDescriptors(). Reports empty list by default.
+    virtual const FieldDescriptorsList& fieldDescriptorsImpl() const;
+
+private:
+    using ToolsPropertiesList = std::vector<std::pair<const char*, QVariant> >;
+
+    ToolsPropertiesList::iterator findToolsProperty(const char* name);
+    ToolsPropertiesList::const_iterator findToolsProperty(const char* name) const;
+
+    ToolsPropertiesList m_toolsProps;
+    std::mutex m_fieldsLock;
+    FieldsListPtr m_transportFields;
+    FieldsListPtr m_payloadFields;
+    std::atomic<unsigned> m_fieldsVersion;
 };
 
 /// @brief Smart pointer to @ref ToolsMessage
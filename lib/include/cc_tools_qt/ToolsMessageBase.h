@@ -22,6 +22,7 @@
 #include "cc_tools_qt/ToolsMessage.h"
 #include "cc_tools_qt/ToolsProtMsgInterface.h"
 #include "cc_tools_qt/details/ToolsFieldCreator.h"
+#include "cc_tools_qt/details/ToolsFieldDescriptorsCreator.h"
 
 #include "comms/util/Tuple.h"
 
@@ -58,6 +59,8 @@ public:
 
     using FieldsList = typename Base::FieldsList;
 
+    using FieldDescriptorsList = typename Base::FieldDescriptorsList;
+
     /// @brief Handler class
     // using Handler = typename CommsBase::Handler;
 
@@ -240,6 +243,13 @@ protected:
         return fields;
     }
 
+    virtual const FieldDescriptorsList& fieldDescriptorsImpl() const override
+    {
+        static const FieldDescriptorsList List =
+            details::ToolsFieldDescriptorsCreator<TActualMsg>::template create<typename ProtMsg::AllFields>();
+        return List;
+    }
+
 private:
     struct HasIdTag {};
     struct NoIdTag {};
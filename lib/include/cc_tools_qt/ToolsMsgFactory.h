@@ -19,9 +19,11 @@
 
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/ToolsMessage.h"
+#include "cc_tools_qt/ToolsMsgPool.h"
 #include "cc_tools_qt/version.h"
 
 #include <list>
+#include <memory>
 #include <vector>
 
 namespace cc_tools_qt
@@ -34,8 +36,20 @@ public:
 
     ToolsMessagePtr createMessage(const QString& idAsString, unsigned idx = 0);
     ToolsMessagePtr createMessage(const qlonglong id, unsigned idx = 0);
+
+    /// @brief Create message, which contents are assigned right away.
+    /// @details The messages are recycled by the per message type pools,
+    ///     which share the limit of the kept released messages.
+    ///     Unlike the createMessage(), the contents of the recycled
+    ///     message are not reset, expected to be fully assigned by the caller
+    ///     (e.g. by the @ref ToolsMessage::assignProtMessage()).
+    ToolsMessagePtr acquireMessage(const qlonglong id, unsigned idx = 0);
+
     ToolsMessagesList createAllMessages();
 
+    /// @brief Delete all the released messages kept for recycling.
+    void clearRecycledMessages();
+
 protected:
     using MessagesListInternal = std::vector<ToolsMessagePtr>;
 
@@ -43,9 +57,15 @@ protected:
     virtual MessagesListInternal createAllMessagesImpl() = 0;
 
 private:
+    using PoolPtr = std::unique_ptr<ToolsMsgPool>;
+    using PoolsList = std::vector<PoolPtr>;
+
     void createDefaultMessagesIfNeeded();
+    ToolsMsgPool* findPool(const qlonglong id, unsigned idx);
 
     MessagesListInternal m_defaultMsgs;
+    PoolsList m_pools; ///< Same order as m_defaultMsgs
+    ToolsMsgPool::LimitPtr m_poolsLimit;
 };
 
 }  // namespace cc_tools_qt
@@ -20,6 +20,7 @@
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/ToolsFilter.h"
 #include "cc_tools_qt/ToolsMessage.h"
+#include "cc_tools_qt/ToolsMsgStats.h"
 #include "cc_tools_qt/ToolsProtocol.h"
 #include "cc_tools_qt/ToolsSocket.h"
 #include "cc_tools_qt/version.h"
@@ -48,6 +49,16 @@ public:
     ToolsProtocolPtr getProtocol() const;
     void setRecvEnabled(bool enabled);
 
+    /// @brief Enable pipelined execution of the received data filtering.
+    /// @details When enabled, every filter processes the received data on its
+    ///     own thread, while the protocol decoding remains on the calling one.
+    ///     Applies only to the leading filters of the chain, which report
+    ///     ToolsFilter::isConcurrentRecvSupported(), the rest are executed on
+    ///     the calling thread. The order of the data is preserved, nothing is
+    ///     dropped: the socket is not read while the pipeline is full.
+    ///     Disabled by default.
+    void setFilterPipelineEnabled(bool enabled);
+
     void deleteMsg(ToolsMessagePtr msg);
     void deleteMsgs(const ToolsMessagesList& msgs);
     void deleteAllMsgs();
@@ -57,6 +68,10 @@ public:
     const ToolsMessagesList& getAllMsgs() const;
     void addMsgs(const ToolsMessagesList& msgs, bool reportAdded = true);
 
+    /// @brief Statistics of the sent / received messages since last clearStats().
+    const ToolsMsgStats& getStats() const;
+    void clearStats();
+
     void setSocket(ToolsSocketPtr socket);
     void setProtocol(ToolsProtocolPtr protocol);
     void addFilter(ToolsFilterPtr filter);
@@ -64,11 +79,16 @@ public:
     using MsgAddedCallbackFunc = std::function<void (ToolsMessagePtr msg)>;
     using ErrorReportCallbackFunc = std::function<void (const QString& error)>;
     using SocketConnectionStatusReportCallbackFunc = std::function<void (bool connected)>;
+    using SocketWriteBlockedReportCallbackFunc = std::function<void (bool blocked)>;
 
     void setMsgAddedCallbackFunc(MsgAddedCallbackFunc&& func);
     void setErrorReportCallbackFunc(ErrorReportCallbackFunc&& func);
     void setSocketConnectionStatusReportCallbackFunc(SocketConnectionStatusReportCallbackFunc&& func);
 
+    /// @brief Set callback to report change of the socket flow control status.
+    /// @details See @ref ToolsSocket::sigWriteBlockedReport().
+    void setSocketWriteBlockedReportCallbackFunc(SocketWriteBlockedReportCallbackFunc&& func);
+
 private:
     std::unique_ptr<ToolsMsgMgrImpl> m_impl;
 };
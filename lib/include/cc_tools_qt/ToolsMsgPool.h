@@ -0,0 +1,98 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace cc_tools_qt
+{
+
+/// @brief Pool of recycled message objects of a single type.
+/// @details The messages created by the pool return to it when
+///     the last reference to them is released (e.g. when the message is
+///     removed from the messages store) instead of being deleted. The
+///     messages released after the pool destruction are deleted as usual.
+///     The properties of the released message are removed on release.
+///     The acquisition is expected to be performed by a single thread,
+///     while the release may happen on any thread.
+///     Multiple pools can share the limit of the kept released messages
+///     (see @ref createLimit()).
+/// @headerfile cc_tools_qt/ToolsMsgPool.h
+class CC_TOOLS_API ToolsMsgPool
+{
+public:
+    /// @brief Type of the function creating a new message object.
+    using CreateFunc = std::function<ToolsMessage::Ptr ()>;
+
+    /// @brief Limit of the kept released messages, opaque type.
+    struct Limit;
+
+    /// @brief Pointer to the @ref Limit, can be shared between the pools.
+    using LimitPtr = std::shared_ptr<Limit>;
+
+    /// @brief Default maximal number of the kept released messages.
+    static const std::size_t DefaultMaxSize = 1024U;
+
+    /// @brief Constructor
+    /// @param[in] func Function to create a new message object when there are
+    ///     no released ones to recycle.
+    /// @param[in] maxSize Maximal number of the released messages to keep,
+    ///     the rest are deleted.
+    explicit ToolsMsgPool(CreateFunc&& func, std::size_t maxSize = DefaultMaxSize);
+
+    /// @brief Constructor
+    /// @param[in] func Function to create a new message object when there are
+    ///     no released ones to recycle.
+    /// @param[in] limit Limit of the released messages to keep shared with
+    ///     other pools, created by @ref createLimit().
+    ToolsMsgPool(CreateFunc&& func, LimitPtr limit);
+
+    /// @brief Destructor
+    ~ToolsMsgPool() noexcept;
+
+    /// @brief Create limit of the kept released messages.
+    /// @param[in] maxSize Maximal total number of the released messages kept
+    ///     by all the pools sharing the limit.
+    static LimitPtr createLimit(std::size_t maxSize);
+
+    /// @brief Acquire message object.
+    /// @details The recycled message has all its properties removed.
+    /// @param[in] resetContents Reset the contents of the recycled message to
+    ///     the default constructed values. Can be @b false when the contents
+    ///     are going to be fully assigned right away (e.g. by
+    ///     @ref ToolsMessage::assignProtMessage()).
+    ToolsMessagePtr acquire(bool resetContents = true);
+
+    /// @brief Delete all the released messages kept for recycling.
+    void clear();
+
+    /// @brief Number of the released messages available for recycling.
+    std::size_t freeCount() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> m_state;
+};
+
+}  // namespace cc_tools_qt
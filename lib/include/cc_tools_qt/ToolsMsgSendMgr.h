@@ -18,6 +18,9 @@
 #pragma once
 
 #include <functional>
+#include <vector>
+
+#include <QtCore/QString>
 
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/ToolsMessage.h"
@@ -33,6 +36,21 @@ public:
     using SendMsgsCallbackFunc = std::function<void (ToolsMessagesList&&)>;
     using SendCompleteCallbackFunc = std::function<void ()>;
 
+    /// @brief Achieved versus requested timing of a single message from the sent list.
+    /// @details All the durations are in microseconds.
+    struct TimingStats
+    {
+        QString m_name;
+        unsigned long long m_requestedPeriod = 0U; ///< Requested repeat period, 0 when not repeated
+        double m_achievedPeriod = 0.0; ///< Average period between the actual sends
+        double m_meanLateness = 0.0; ///< Average delay of the send after its deadline
+        unsigned long long m_maxLateness = 0U; ///< Worst delay of the send after its deadline
+        unsigned long long m_count = 0U; ///< Number of sends
+        unsigned long long m_missedCount = 0U; ///< Number of skipped overdue repetitions
+    };
+
+    using TimingStatsList = std::vector<TimingStats>;
+
     ToolsMsgSendMgr();
     ~ToolsMsgSendMgr() noexcept;
 
@@ -41,8 +59,30 @@ public:
 
     void start(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs);
 
+    /// @brief Send the messages back-to-back as fast as possible.
+    /// @details The delays and repeat settings of the messages are ignored,
+    ///     the whole list is sent @b count times. The messages are encoded
+    ///     once and passed to the send callback in large batches.
+    void startBurst(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, unsigned count);
+
     void stop();
 
+    /// @brief Pause / resume the sending.
+    /// @details Expected to be driven by the socket flow control (see
+    ///     @ref ToolsSocket::sigWriteBlockedReport()). While paused no
+    ///     messages are passed to the send callback. Upon resume the
+    ///     remaining schedule is shifted by the pause duration, so the
+    ///     relative timing of the messages is preserved instead of
+    ///     sending all the overdue ones at once.
+    void setPaused(bool paused);
+
+    /// @brief Check the sending is paused.
+    bool isPaused() const;
+
+    /// @brief Get timing statistics of the current (or last) sending session.
+    /// @details Reported per message of the list passed to @ref start().
+    TimingStatsList getTimingStats() const;
+
 private:
     std::unique_ptr<ToolsMsgSendMgrImpl> m_impl;
 };
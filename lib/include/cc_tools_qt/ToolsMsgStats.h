@@ -0,0 +1,119 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <QtCore/QString>
+
+#include <array>
+#include <cstddef>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+/// @brief Incremental statistics of the sent / received messages.
+/// @details Maintained per message type and direction. Every update is
+///     O(1), while the rates over the sliding windows are calculated
+///     only when the @ref snapshot() is requested. Not thread safe,
+///     expected to be used by the thread processing the messages.
+/// @headerfile cc_tools_qt/ToolsMsgStats.h
+class CC_TOOLS_API ToolsMsgStats
+{
+public:
+    using MsgType = ToolsMessage::Type;
+
+    /// @brief Timestamp in milliseconds since epoch
+    using Timestamp = unsigned long long;
+
+    /// @brief Sliding windows of the rates calculation
+    enum RateWindow : unsigned
+    {
+        RateWindow_1sec, ///< Last second
+        RateWindow_10sec, ///< Last 10 seconds
+        RateWindow_60sec, ///< Last minute
+        RateWindow_NumOfValues ///< Number of available values
+    };
+
+    /// @brief Number of the inter-arrival time histogram bins
+    /// @details Bin 0 counts intervals below 1ms, bin N counts intervals
+    ///     in range [2^(N-1), 2^N) ms, the last bin counts all the longer ones.
+    static constexpr unsigned HistogramBinsCount = 16U;
+
+    using Rates = std::array<double, RateWindow_NumOfValues>;
+    using Histogram = std::array<unsigned long long, HistogramBinsCount>;
+
+    struct Entry
+    {
+        QString m_name;
+        QString m_id;
+        MsgType m_type = MsgType::Invalid;
+        unsigned long long m_count = 0U;
+        unsigned long long m_bytes = 0U;
+        unsigned long long m_invalidCount = 0U;
+        Timestamp m_firstTimestamp = 0U;
+        Timestamp m_lastTimestamp = 0U;
+        Rates m_rates = Rates(); ///< Messages per second, reported by @ref snapshot()
+        Histogram m_interArrival = Histogram();
+    };
+
+    using EntriesList = std::vector<Entry>;
+
+    ToolsMsgStats();
+    ~ToolsMsgStats() noexcept;
+
+    /// @brief Account the message.
+    /// @param[in] msg Message object, expected to have type and timestamp properties set.
+    /// @param[in] length Number of the sent / received bytes.
+    void update(const ToolsMessage& msg, std::size_t length);
+
+    void clear();
+
+    /// @brief Get the current statistics of all the message types.
+    /// @param[in] now Current time used to calculate the rates.
+    EntriesList snapshot(Timestamp now) const;
+
+    /// @brief Get the current time in the units of the message timestamps.
+    static Timestamp currentTimestamp();
+
+    static unsigned rateWindowSec(RateWindow window);
+
+private:
+    static constexpr unsigned MaxRateWindowSec = 60U;
+
+    // The current (not completed) second occupies an extra slot
+    static constexpr unsigned RateSlotsCount = MaxRateWindowSec + 1U;
+
+    struct TypeState
+    {
+        Entry m_entry;
+        std::array<Timestamp, RateSlotsCount> m_slotSec = std::array<Timestamp, RateSlotsCount>();
+        std::array<unsigned long long, RateSlotsCount> m_slotCount = std::array<unsigned long long, RateSlotsCount>();
+    };
+
+    using TypesMap = std::unordered_map<std::type_index, std::size_t>;
+
+    std::array<TypesMap, static_cast<unsigned>(MsgType::NumOfValues)> m_typesMaps;
+    std::vector<TypeState> m_states;
+};
+
+}  // namespace cc_tools_qt
@@ -96,6 +96,10 @@ public:
     /// @brief Create dummy message containing invalid input
     ToolsMessagePtr createInvalidMessage(const MsgDataSeq& data);
 
+    /// @brief Delete the released message objects kept for recycling.
+    /// @details Expected to be invoked when the messages get cleared.
+    void clearRecycledMessages();
+
     /// @brief Make the protocol aware about socket connection status
     /// @details Invokes @ref socketConnectionReportImpl().
     /// @param[in] connected Socket connection status.
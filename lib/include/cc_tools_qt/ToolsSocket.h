@@ -21,6 +21,8 @@
 #include "cc_tools_qt/ToolsDataInfo.h"
 #include "cc_tools_qt/version.h"
 
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
 #include <QtCore/QObject>
 #include <QtCore/QString>
 
@@ -47,6 +49,9 @@ public:
         ConnectionProperty_NonDisconnectable = 0x2 ///< Do not allow socket disconnection
     };
 
+    /// @brief List of outgoing data chunks
+    using DataInfosList = QList<ToolsDataInfoPtr>;
+
     /// @brief Constructor
     ToolsSocket();
 
@@ -95,6 +100,45 @@ public:
     /// @param[in] dataPtr Information about outging data
     void sendData(ToolsDataInfoPtr dataPtr);
 
+    /// @brief Request socket to send multiple data chunks at once
+    /// @details Invokes the sendDataListImpl(), which can be overridden in
+    ///     the derived class to coalesce the writes.
+    /// @param[in] dataList Information about outgoing data chunks, in order
+    void sendDataList(const DataInfosList& dataList);
+
+    /// @brief Get number of bytes accepted for sending, but not written
+    ///     to the I/O link yet.
+    /// @details Invokes the pendingBytesImpl(), which can be overridden in
+    ///     the derived class.
+    unsigned long long pendingBytes() const;
+
+    /// @brief Get number of the incoming data chunks (e.g. datagrams) dropped
+    ///     before being read from the I/O link.
+    /// @details Invokes the droppedCountImpl(), which can be overridden in
+    ///     the derived class.
+    unsigned long long droppedCount() const;
+
+    /// @brief Set flow control watermarks.
+    /// @details When number of the @ref pendingBytes() reaches the @b high
+    ///     watermark after a send, the socket is reported as write blocked
+    ///     (see @ref sigWriteBlockedReport()) until the number of pending
+    ///     bytes drops to the @b low watermark. The @b high watermark of @b 0
+    ///     disables the flow control.
+    /// @param[in] high High watermark in bytes.
+    /// @param[in] low Low watermark in bytes, expected to be less than @b high.
+    void setWatermarks(unsigned long long high, unsigned long long low);
+
+    /// @brief Get high watermark in bytes.
+    unsigned long long highWatermark() const;
+
+    /// @brief Get low watermark in bytes.
+    unsigned long long lowWatermark() const;
+
+    /// @brief Check the socket is write blocked.
+    /// @details The sending is still allowed, but the sender is expected to
+    ///     pause until the socket drains the pending data.
+    bool isWriteBlocked() const;
+
     /// @brief Get properties describing socket connection right after plugins
     ///     have been loaded and applied.
     /// @details The returned value is used by the driving application to
@@ -111,6 +155,18 @@ public:
     /// @param[in] props Properties map.
     void applyInterPluginConfig(const QVariantMap& props);
 
+    /// @brief Enable / disable report of the received data.
+    /// @details When disabled, the received data is not reported via
+    ///     @ref sigDataReceivedReport(). Sockets that do more than just
+    ///     reporting the received data (e.g. forwarding it) can check
+    ///     @ref isDataReceivedReportEnabled() to skip its preparation
+    ///     for reporting altogether. Enabled by default.
+    void setDataReceivedReportEnabled(bool enabled);
+
+    /// @brief Check the received data is reported.
+    /// @details Thread safe, can be invoked by the I/O thread of the derived class.
+    bool isDataReceivedReportEnabled() const;
+
     /// @brief Set debug output level
     /// @param[in] level Debug level. If @b 0, debug output is disabled
     void setDebugOutputLevel(unsigned level = 0U);
@@ -120,6 +176,10 @@ signals:
     /// @param[in] data New data object
     void sigDataReceivedReport(ToolsDataInfoPtr data);
 
+    /// @brief Signal used to report arrival of multiple data chunks at once
+    /// @param[in] dataList New data objects, in order of arrival
+    void sigDataListReceivedReport(const cc_tools_qt::ToolsSocket::DataInfosList& dataList);
+
     /// @brief Signal used to report error
     /// @param[in] msg Error message.
     void sigErrorReport(const QString& msg);
@@ -132,6 +192,15 @@ signals:
     /// @param[in] props Configuration properties.
     void sigInterPluginConfigReport(const QVariantMap& props);
 
+    /// @brief Signal to report change of the write blocked status.
+    /// @param[in] blocked Whether the number of pending bytes reached the
+    ///     high watermark (@b true) or dropped to the low one (@b false).
+    void sigWriteBlockedReport(bool blocked);
+
+    /// @brief Signal to report no more data is expected from the source.
+    /// @param[in] source Value of the @ref ToolsDataInfo::m_source of the received data.
+    void sigSourceClosedReport(const QString& source);
+
 protected:
     /// @brief Polymorphic start functionality implementation.
     /// @details Invoked by start() and default implementation does nothing.
@@ -160,6 +229,26 @@ protected:
     ///     the derived class.
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) = 0;
 
+    /// @brief Polymorphic multiple data chunks send functionality implementation.
+    /// @details Invoked by sendDataList(). The default implementation invokes
+    ///     sendDataImpl() for every chunk. Stream oriented sockets are expected
+    ///     to override it and write all the chunks at once (see @ref concatData()),
+    ///     while datagram oriented ones need to preserve the chunks boundaries.
+    virtual void sendDataListImpl(const DataInfosList& dataList);
+
+    /// @brief Polymorphic pending bytes calculation functionality implementation.
+    /// @details Invoked by pendingBytes(). The default implementation returns
+    ///     @b 0, i.e. the socket doesn't buffer the outgoing data. Sockets
+    ///     with internal write buffers are expected to override it and
+    ///     invoke @ref reportBytesWritten() when some of the data is written.
+    virtual unsigned long long pendingBytesImpl() const;
+
+    /// @brief Polymorphic dropped data chunks count functionality implementation.
+    /// @details Invoked by droppedCount(). The default implementation returns
+    ///     @b 0. Sockets capable of detecting the incoming data loss (e.g. due
+    ///     to the overflow of the kernel receive buffer) are expected to override it.
+    virtual unsigned long long droppedCountImpl() const;
+
     /// @brief Polymorphic connection properties functionality implementation.
     /// @details Invoked by connectionProperties(). In can be overriden by the
     ///     derived class.
@@ -177,6 +266,9 @@ protected:
     /// @brief Get current debug output level
     unsigned getDebugOutputLevel() const;
 
+    /// @brief Concatenate the data of all the chunks into a single buffer.
+    static QByteArray concatData(const DataInfosList& dataList);
+
 protected slots:
     /// @brief Report new data has been received.
     /// @details This function needs to be invoked by the derived class when
@@ -185,6 +277,13 @@ protected slots:
     /// @param[in] dataPtr New data information.
     void reportDataReceived(ToolsDataInfoPtr dataPtr);
 
+    /// @brief Report multiple data chunks have been received at once.
+    /// @details Allows the derived class reading the I/O link in batches
+    ///     to hand the whole batch over for processing, emits
+    ///     @ref sigDataListReceivedReport() signal.
+    /// @param[in] dataList New data information, in order of arrival.
+    void reportDataListReceived(cc_tools_qt::ToolsSocket::DataInfosList dataList);
+
     /// @brief Report I/O operation error.
     /// @details This function is expected to be invoked by the derived class,
     ///     when some error is detected. This function will emit
@@ -208,7 +307,26 @@ protected slots:
     /// @param[in] props Reported properties.
     void reportInterPluginConfig(const QVariantMap& props);
 
+    /// @brief Report some of the pending data has been written to the I/O link.
+    /// @details This function is expected to be invoked by the derived class
+    ///     overriding @ref pendingBytesImpl(). It emits @ref sigWriteBlockedReport()
+    ///     when the number of pending bytes drops to the low watermark.
+    void reportBytesWritten();
+
+    /// @brief Report no more data is expected from the source.
+    /// @details Sockets receiving data from multiple sources (e.g. connections)
+    ///     are expected to tag the reported data with @ref ToolsDataInfo::m_source
+    ///     and invoke this function when the source is gone to allow release of
+    ///     the resources used for its decoding. Emits @ref sigSourceClosedReport().
+    /// @param[in] source Source identifier.
+    void reportSourceClosed(const QString& source);
+
 private:
+    void prepareSentData(ToolsDataInfo& data);
+    void prepareReceivedData(ToolsDataInfo& data);
+    void checkHighWatermark();
+    void setWriteBlocked(bool blocked);
+
     struct InnerState;
     std::unique_ptr<InnerState> m_state;
 };
@@ -218,3 +336,5 @@ using ToolsSocketPtr = std::shared_ptr<ToolsSocket>;
 
 }  // namespace cc_tools_qt
 
+Q_DECLARE_METATYPE(cc_tools_qt::ToolsSocket::DataInfosList);
+
@@ -66,6 +66,9 @@ public:
     {
         assert(func);
         m_wrapFieldFunc = std::move(func);
+
+        // Elements are wrapped only when the members are accessed
+        Base::invalidateMembers();
     }
 
 protected:
@@ -159,17 +162,9 @@ protected:
         refreshMembersInternal(Tag());
     }
 
-    virtual void membersUpdatedImpl() override
+    virtual void createMembersImpl() override
     {
-        if (isHiddenSerializationImpl()) {
-            return;
-        }
-
-        auto& mems = Base::getMembers();
-        for (auto& m : mems) {
-            assert(m);
-            m->forceHiddenSerialization();
-        }
+        refreshMembersImpl();
     }
 
 private:
@@ -239,6 +234,7 @@ private:
         }
 
         auto& storage = Base::field().value();
+        bool hideMembersSer = !isHiddenSerializationImpl();
         Members mems;
         mems.reserve(storage.size());
         for (auto& f : storage) {
@@ -247,6 +243,11 @@ private:
                 mems.back()->reset();
                 assert(mems.back()->canWrite());
             }
+
+            // Forced before the members are published to other threads
+            if (hideMembersSer) {
+                mems.back()->forceHiddenSerialization();
+            }
         }
 
         Base::setMembers(std::move(mems));
@@ -236,7 +236,6 @@ private:
                 return ToolsFieldCreator::createField(memField);
             });
 
-        toolsField->refreshMembers();
         return toolsField;
     }
 
@@ -0,0 +1,359 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "cc_tools_qt/ToolsFieldDescriptor.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include "comms/comms.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace cc_tools_qt
+{
+
+namespace details
+{
+
+/// @brief Generates flat descriptors of the payload fields of the message type.
+/// @tparam TMsg Actual tools message class, expected to provide access to
+///     the protocol message via @b msg() member function.
+template <typename TMsg>
+class ToolsFieldDescriptorsCreator
+{
+    using Kind = ToolsFieldDescriptor::Kind;
+
+public:
+    using List = ToolsFieldDescriptorsList;
+
+    template <typename TFields>
+    static List create()
+    {
+        List list;
+        std::size_t offset = 0U;
+        addMembers<RootAccess, TFields>(
+            list, -1, QString(), offset, std::make_index_sequence<std::tuple_size<TFields>::value>());
+        return list;
+    }
+
+private:
+    using IntValueTag = comms::field::tag::Int;
+    using BitmaskValueTag = comms::field::tag::Bitmask;
+    using EnumValueTag = comms::field::tag::Enum;
+    using StringTag = comms::field::tag::String;
+    using BitfieldTag = comms::field::tag::Bitfield;
+    using OptionalTag = comms::field::tag::Optional;
+    using BundleTag = comms::field::tag::Bundle;
+    using RawDataArrayListTag = comms::field::tag::RawArrayList;
+    using FieldsArrayListTag = comms::field::tag::ArrayList;
+    using FloatValueTag = comms::field::tag::Float;
+    using VariantTag = comms::field::tag::Variant;
+
+    struct RootAccess
+    {
+        static const auto& members(const ToolsMessage& msg)
+        {
+            assert(dynamic_cast<const TMsg*>(&msg) != nullptr);
+            return static_cast<const TMsg&>(msg).msg().fields();
+        }
+    };
+
+    template <typename TParentAccess, std::size_t TIdx>
+    struct MemberAccess
+    {
+        static const auto& field(const ToolsMessage& msg)
+        {
+            return std::get<TIdx>(TParentAccess::members(msg));
+        }
+
+        static const auto& members(const ToolsMessage& msg)
+        {
+            return field(msg).value();
+        }
+    };
+
+    template <typename TAccess>
+    static QVariant readValue(const ToolsMessage& msg)
+    {
+        return fieldValue(TAccess::field(msg));
+    }
+
+    template <typename TAccess>
+    static ToolsFieldDescriptor::DataView readData(const ToolsMessage& msg)
+    {
+        const auto& data = TAccess::field(msg).value();
+        ToolsFieldDescriptor::DataView view;
+        view.m_data = data.data();
+        view.m_size = data.size();
+        return view;
+    }
+
+    template <typename TParentAccess, typename TMembers, std::size_t... TIdx>
+    static void addMembers(
+        [[maybe_unused]] List& list,
+        [[maybe_unused]] int parentIdx,
+        [[maybe_unused]] const QString& prefix,
+        [[maybe_unused]] std::size_t& offset,
+        std::index_sequence<TIdx...>)
+    {
+        (addField<MemberAccess<TParentAccess, TIdx>, std::tuple_element_t<TIdx, TMembers>>(list, parentIdx, prefix, offset), ...);
+    }
+
+    template <typename TAccess, typename TField>
+    static void addField(List& list, int parentIdx, const QString& prefix, std::size_t& offset)
+    {
+        using Tag = typename TField::CommsTag;
+
+        ToolsFieldDescriptor desc;
+        desc.m_name = TField::name();
+        desc.m_path = prefix.isEmpty() ? QString(desc.m_name) : (prefix + QChar('.') + desc.m_name);
+        desc.m_kind = fieldKind<TField>(Tag());
+        desc.m_parent = parentIdx;
+        desc.m_offset = offset;
+        desc.m_minLength = TField::minLength();
+        desc.m_maxLength = TField::maxLength();
+        desc.m_valueFunc = &readValue<TAccess>;
+        desc.m_dataFunc = dataFunc<TAccess>(Tag());
+
+        auto path = desc.m_path;
+        auto idx = static_cast<int>(list.size());
+        list.push_back(std::move(desc));
+
+        addFieldMembers<TAccess, TField>(list, idx, path, offset, Tag());
+
+        if ((offset != ToolsFieldDescriptor::NoOffset) && (TField::minLength() == TField::maxLength())) {
+            offset += TField::minLength();
+            return;
+        }
+
+        offset = ToolsFieldDescriptor::NoOffset;
+    }
+
+    template <typename TAccess, typename TField>
+    static void addFieldMembers(List& list, int parentIdx, const QString& prefix, std::size_t offset, BundleTag)
+    {
+        using Members = typename TField::ValueType;
+        addMembers<TAccess, Members>(
+            list, parentIdx, prefix, offset, std::make_index_sequence<std::tuple_size<Members>::value>());
+    }
+
+    template <typename TAccess, typename TField>
+    static void addFieldMembers(List& list, int parentIdx, const QString& prefix, [[maybe_unused]] std::size_t offset, BitfieldTag)
+    {
+        // Members of the bitfield don't start on byte boundary
+        using Members = typename TField::ValueType;
+        std::size_t memberOffset = ToolsFieldDescriptor::NoOffset;
+        addMembers<TAccess, Members>(
+            list, parentIdx, prefix, memberOffset, std::make_index_sequence<std::tuple_size<Members>::value>());
+    }
+
+    template <typename TAccess, typename TField, typename TTag>
+    static void addFieldMembers(
+        [[maybe_unused]] List& list,
+        [[maybe_unused]] int parentIdx,
+        [[maybe_unused]] const QString& prefix,
+        [[maybe_unused]] std::size_t offset,
+        TTag)
+    {
+    }
+
+    template <typename TAccess>
+    static ToolsFieldDescriptor::DataFunc dataFunc(RawDataArrayListTag)
+    {
+        return &readData<TAccess>;
+    }
+
+    template <typename TAccess, typename TTag>
+    static ToolsFieldDescriptor::DataFunc dataFunc(TTag)
+    {
+        return nullptr;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(IntValueTag)
+    {
+        using ValueType = typename TField::ValueType;
+        if constexpr (std::is_signed_v<ValueType> || (sizeof(ValueType) < sizeof(std::uint64_t))) {
+            return Kind::Int;
+        }
+
+        return Kind::UnsignedLong;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(BitmaskValueTag)
+    {
+        return Kind::Bitmask;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(EnumValueTag)
+    {
+        return Kind::Enum;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(StringTag)
+    {
+        return Kind::String;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(BitfieldTag)
+    {
+        return Kind::Bitfield;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(OptionalTag)
+    {
+        return Kind::Optional;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(BundleTag)
+    {
+        return Kind::Bundle;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(RawDataArrayListTag)
+    {
+        return Kind::RawData;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(FieldsArrayListTag)
+    {
+        return Kind::ArrayList;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(FloatValueTag)
+    {
+        return Kind::Float;
+    }
+
+    template <typename TField>
+    static Kind fieldKind(VariantTag)
+    {
+        return Kind::Variant;
+    }
+
+    template <typename TField, typename TTag>
+    static Kind fieldKind(TTag)
+    {
+        return Kind::Unknown;
+    }
+
+    template <typename TField>
+    static QVariant fieldValue(const TField& field)
+    {
+        using Tag = typename TField::CommsTag;
+        return fieldValueInternal(field, Tag());
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, IntValueTag)
+    {
+        using ValueType = typename TField::ValueType;
+        if constexpr (std::is_signed_v<ValueType> || (sizeof(ValueType) < sizeof(std::uint64_t))) {
+            return QVariant(static_cast<qlonglong>(field.getValue()));
+        }
+        else {
+            return QVariant(static_cast<qulonglong>(field.getValue()));
+        }
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, BitmaskValueTag)
+    {
+        return QVariant(static_cast<qulonglong>(field.getValue()));
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, EnumValueTag)
+    {
+        return QVariant(static_cast<qlonglong>(field.getValue()));
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, StringTag)
+    {
+        const auto& str = field.getValue();
+        return QVariant(QString::fromUtf8(str.c_str(), static_cast<int>(str.size())));
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, OptionalTag)
+    {
+        if (!field.doesExist()) {
+            return QVariant();
+        }
+
+        return fieldValue(field.field());
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, RawDataArrayListTag)
+    {
+        const auto& data = field.value();
+        return QVariant(QByteArray(reinterpret_cast<const char*>(data.data()), static_cast<int>(data.size())));
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, FieldsArrayListTag)
+    {
+        return QVariant(static_cast<qulonglong>(field.value().size()));
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, FloatValueTag)
+    {
+        return QVariant(static_cast<double>(field.getValue()));
+    }
+
+    template <typename TField>
+    static QVariant fieldValueInternal(const TField& field, VariantTag)
+    {
+        if (!field.currentFieldValid()) {
+            return QVariant();
+        }
+
+        return QVariant(static_cast<qlonglong>(field.currentField()));
+    }
+
+    template <typename TField, typename TTag>
+    static QVariant fieldValueInternal([[maybe_unused]] const TField& field, TTag)
+    {
+        return QVariant();
+    }
+};
+
+}  // namespace details
+
+}  // namespace cc_tools_qt
@@ -59,23 +59,17 @@ protected:
 
     virtual QString getValueImpl() const override
     {
-        QString retStr;
-        auto& dataField = Base::field();
-        auto& data = dataField.value();
-
         int maxLen = static_cast<int>(Base::length() * 2);
         if (Base::isTruncated()) {
             maxLen = static_cast<decltype(maxLen)>(Base::TruncateLength * 2);
         }
 
-        for (auto byte : data) {
-            if (maxLen <= retStr.size()) {
-                break;
-            }
+        return valueToString(maxLen);
+    }
 
-            retStr.append(QString("%1").arg(static_cast<uint>(byte), 2, 16, QChar('0')));
-        }
-        return retStr;
+    virtual QString getFullValueImpl() const override
+    {
+        return valueToString(static_cast<int>(Base::length() * 2));
     }
 
     virtual void setValueImpl(const QString& val) override
@@ -150,6 +144,22 @@ protected:
     }
 
 private:
+    QString valueToString(int maxLen) const
+    {
+        QString retStr;
+        auto& dataField = Base::field();
+        auto& data = dataField.value();
+
+        for (auto byte : data) {
+            if (maxLen <= retStr.size()) {
+                break;
+            }
+
+            retStr.append(QString("%1").arg(static_cast<uint>(byte), 2, 16, QChar('0')));
+        }
+        return retStr;
+    }
+
     struct SizeFieldExistsTag {};
     struct SerLengthFieldExistsTag {};
     struct FixedSizeTag {};
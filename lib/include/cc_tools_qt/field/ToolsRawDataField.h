@@ -39,6 +39,11 @@ public:
 
     QString getValue() const;
 
+    /// @brief Get the whole value ignoring truncation.
+    /// @details Doesn't modify the forced "show all" mode of the wrapper,
+    ///     invokes getFullValueImpl().
+    QString getFullValue() const;
+
     void setValue(const QString& val);
 
     int maxSize() const;
@@ -53,6 +58,7 @@ public:
 
 protected:
     virtual QString getValueImpl() const = 0;
+    virtual QString getFullValueImpl() const = 0;
     virtual void setValueImpl(const QString& val) = 0;
     virtual int maxSizeImpl() const = 0;
     virtual int minSizeImpl() const = 0;
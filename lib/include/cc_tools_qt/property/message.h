@@ -18,6 +18,7 @@
 #pragma once
 
 #include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsDataInfo.h"
 #include "cc_tools_qt/ToolsMessage.h"
 
 #include <QtCore/QObject>
@@ -51,6 +52,13 @@ public:
         assert(obj.property(m_propName).template canConvert<ValueType>());
     }
 
+    template <typename U>
+    void setTo(U&& val, ToolsMessage& msg) const
+    {
+        msg.setToolsProperty(m_propName, QVariant::fromValue(std::forward<U>(val)));
+        assert(msg.toolsProperty(m_propName).template canConvert<ValueType>());
+    }
+
     template <typename U>
     void setTo(U&& val, QVariantMap& map) const
     {
@@ -69,6 +77,16 @@ public:
         return var.template value<ValueType>();
     }
 
+    ValueType getFrom(const ToolsMessage& msg, const ValueType& defaultVal = ValueType()) const
+    {
+        auto var = msg.toolsProperty(m_propName);
+        if ((!var.isValid()) || (!var.template canConvert<ValueType>())) {
+            return defaultVal;
+        }
+
+        return var.template value<ValueType>();
+    }
+
     ValueType getFrom(const QVariantMap& map, const ValueType& defaultVal = ValueType()) const
     {
         QString name(m_propName);
@@ -88,6 +106,14 @@ public:
         }
     }
 
+    void copyFromTo(const ToolsMessage& from, ToolsMessage& to) const
+    {
+        auto var = from.toolsProperty(m_propName);
+        if (var.isValid()) {
+            to.setToolsProperty(m_propName, std::move(var));
+        }
+    }
+
 private:
     const char* m_propName = nullptr;
 };
@@ -169,6 +195,13 @@ public:
     ToolsMsgForceExtraInfoExistence();
 };
 
+class CC_TOOLS_API ToolsMsgFramedData : public ToolsMsgPropBase<ToolsDataInfoPtr>
+{
+    using Base = ToolsMsgPropBase<ToolsDataInfoPtr>;
+public:
+    ToolsMsgFramedData();
+};
+
 class CC_TOOLS_API ToolsMsgDelay : public ToolsMsgPropBase<unsigned long long>
 {
     using Base = ToolsMsgPropBase<unsigned long long>;
@@ -197,6 +230,20 @@ public:
     ToolsMsgRepeatDurationUnits();
 };
 
+class CC_TOOLS_API ToolsMsgDelayUs : public ToolsMsgPropBase<unsigned long long>
+{
+    using Base = ToolsMsgPropBase<unsigned long long>;
+public:
+    ToolsMsgDelayUs();
+};
+
+class CC_TOOLS_API ToolsMsgRepeatDurationUs : public ToolsMsgPropBase<unsigned long long>
+{
+    using Base = ToolsMsgPropBase<unsigned long long>;
+public:
+    ToolsMsgRepeatDurationUs();
+};
+
 class CC_TOOLS_API ToolsMsgRepeatCount : public ToolsMsgPropBase<unsigned>
 {
     using Base = ToolsMsgPropBase<unsigned>;
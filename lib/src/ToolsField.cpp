@@ -18,6 +18,8 @@
 #include "cc_tools_qt/ToolsField.h"
 
 #include <cassert>
+#include <mutex>
+#include <tuple>
 #include <vector>
 #include <utility>
 
@@ -27,21 +29,24 @@ namespace cc_tools_qt
 namespace
 {
 
-const QString& readOnlyProp()
+enum ForcedFlag : unsigned
 {
-    static const QString Str("cc.read_only");
-    return Str;
-}
+    ForcedFlag_ReadOnly = 1U << 0,
+    ForcedFlag_HiddenSerialization = 1U << 1,
+};
 
-const QString& hiddenSerializationProp()
+std::mutex& membersCreationMutex()
 {
-    static const QString Str("cc.hidden_ser");
-    return Str;
+    static std::mutex Mutex;
+    return Mutex;
 }
 
 } // namespace
 
-ToolsField::ToolsField() = default;
+ToolsField::ToolsField() :
+    m_membersPending(false)
+{
+}
 
 ToolsField::~ToolsField() noexcept = default;
 
@@ -115,6 +120,14 @@ void ToolsField::dispatch(ToolsFieldHandler& handler)
 
 ToolsField::Ptr ToolsField::clone()
 {
+    if (m_membersPending.load(std::memory_order_acquire)) {
+        // The clone creates its own members on first access
+        auto ptr = cloneImpl();
+        ptr->m_forcedFlags = m_forcedFlags;
+        ptr->invalidateMembers();
+        return ptr;
+    }
+
     Members clonedMembers;
     clonedMembers.reserve(m_members.size());
     for (auto& m : m_members) {
@@ -122,7 +135,7 @@ ToolsField::Ptr ToolsField::clone()
     }
     auto ptr = cloneImpl();
     ptr->setMembers(std::move(clonedMembers));
-    ptr->m_props = m_props;
+    ptr->m_forcedFlags = m_forcedFlags;
     return ptr;
 }
 
@@ -138,39 +151,45 @@ void ToolsField::reset()
 
 ToolsField::Members& ToolsField::getMembers()
 {
+    ensureMembers();
     return m_members;
 }
 
 const ToolsField::Members& ToolsField::getMembers() const
 {
+    ensureMembers();
     return m_members;
 }
 
 void ToolsField::setMembers(Members&& members)
 {
-    m_members = std::move(members);
-    for (auto& m : m_members) {
+    for (auto& m : members) {
         using CheckFunc = bool (ToolsField::*)() const;
         using ForceFunc = void (ToolsField::*)();
-        static const std::vector<std::pair<CheckFunc, ForceFunc>> List = {
-            {&ToolsField::isReadOnly, &ToolsField::forceReadOnly},
-            {&ToolsField::isHiddenSerialization, &ToolsField::forceHiddenSerialization},
+        static const std::vector<std::tuple<CheckFunc, ForceFunc, unsigned>> List = {
+            {&ToolsField::isReadOnly, &ToolsField::forceReadOnly, ForcedFlag_ReadOnly},
+            {&ToolsField::isHiddenSerialization, &ToolsField::forceHiddenSerialization, ForcedFlag_HiddenSerialization},
         };
 
         assert(m);
         for (auto& funcs : List) {
-            if ((m.get()->*funcs.first)()) {
-                (m.get()->*funcs.second)();
+            // The members created after the property was forced
+            // on this field inherit it.
+            bool forced = ((m_forcedFlags & std::get<2>(funcs)) != 0U);
+            if (forced || (m.get()->*std::get<0>(funcs))()) {
+                (m.get()->*std::get<1>(funcs))();
             }
         }
     }
 
+    m_members = std::move(members);
     membersUpdatedImpl();
+    m_membersPending.store(false, std::memory_order_release);
 }
 
 void ToolsField::forceReadOnly()
 {
-    m_props[readOnlyProp()] = true;
+    m_forcedFlags |= ForcedFlag_ReadOnly;
     for (auto& m : m_members) {
         assert(m);
         m->forceReadOnly();
@@ -179,7 +198,7 @@ void ToolsField::forceReadOnly()
 
 bool ToolsField::isReadOnly() const
 {
-    if (m_props.contains(readOnlyProp())) {
+    if ((m_forcedFlags & ForcedFlag_ReadOnly) != 0U) {
         return true;
     }
 
@@ -188,7 +207,7 @@ bool ToolsField::isReadOnly() const
 
 void ToolsField::forceHiddenSerialization()
 {
-    m_props[hiddenSerializationProp()] = true;
+    m_forcedFlags |= ForcedFlag_HiddenSerialization;
     for (auto& m : m_members) {
         assert(m);
         m->forceHiddenSerialization();
@@ -197,7 +216,7 @@ void ToolsField::forceHiddenSerialization()
 
 bool ToolsField::isHiddenSerialization() const
 {
-    if (m_props.contains(hiddenSerializationProp())) {
+    if ((m_forcedFlags & ForcedFlag_HiddenSerialization) != 0U) {
         return true;
     }
 
@@ -208,5 +227,31 @@ void ToolsField::membersUpdatedImpl()
 {
 }
 
+void ToolsField::invalidateMembers()
+{
+    m_members.clear();
+    m_membersPending.store(true, std::memory_order_release);
+}
+
+void ToolsField::createMembersImpl()
+{
+}
+
+void ToolsField::ensureMembers() const
+{
+    if (!m_membersPending.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    // The cached wrappers of the same message can be accessed from multiple threads
+    std::lock_guard<std::mutex> guard(membersCreationMutex());
+    if (!m_membersPending.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    auto* thisPtr = const_cast<ToolsField*>(this);
+    thisPtr->createMembersImpl();
+    m_membersPending.store(false, std::memory_order_release);
+}
 }  // namespace cc_tools_qt
 
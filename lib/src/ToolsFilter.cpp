@@ -17,6 +17,7 @@
 
 #include "cc_tools_qt/ToolsFilter.h"
 
+#include <cassert>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -41,11 +42,23 @@ std::string dataToStr(const ToolsDataInfo::DataSeq& data)
     return stream.str();
 }
 
+unsigned long long debugTimestamp(const ToolsDataInfo& data)
+{
+    auto timestamp = data.m_timestamp;
+    if (timestamp == ToolsDataInfo::Timestamp()) {
+        timestamp = ToolsDataInfo::TimestampClock::now();
+    }
+
+    auto sinceEpoch = timestamp.time_since_epoch();
+    return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count());
+}
+
 } // namespace
 
 struct ToolsFilter::InnerState
 {
     unsigned m_debugLevel = 0U;
+    bool m_concurrentRecvSupported = false;
 };
 
 ToolsFilter::ToolsFilter() :
@@ -67,26 +80,54 @@ void ToolsFilter::stop()
 
 QList<ToolsDataInfoPtr> ToolsFilter::recvData(ToolsDataInfoPtr dataPtr)
 {
-    unsigned long long milliseconds = 0U;
+    DataInfosSeq data;
+    data.push_back(std::move(dataPtr));
+    DataInfosSeq out;
+    recvDataList(data, out);
 
-    if (1U <= m_state->m_debugLevel) {
-        auto timestamp = dataPtr->m_timestamp;
-        if (timestamp == ToolsDataInfo::Timestamp()) {
-            timestamp = ToolsDataInfo::TimestampClock::now();
-        }
+    QList<ToolsDataInfoPtr> result;
+    for (auto& d : out) {
+        result.append(std::move(d));
+    }
+    return result;
+}
 
-        auto sinceEpoch = timestamp.time_since_epoch();
-        milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
-        std::cout << '[' << milliseconds << "] (" << debugNameImpl() << ") <-- " << dataPtr->m_data.size() << " bytes";
-        if (2U <= m_state->m_debugLevel) {
-            std::cout << " | " << dataToStr(dataPtr->m_data);
+QList<ToolsDataInfoPtr> ToolsFilter::sendData(ToolsDataInfoPtr dataPtr)
+{
+    DataInfosSeq data;
+    data.push_back(std::move(dataPtr));
+    DataInfosSeq out;
+    sendDataList(data, out);
+
+    QList<ToolsDataInfoPtr> result;
+    for (auto& d : out) {
+        result.append(std::move(d));
+    }
+    return result;
+}
+
+void ToolsFilter::recvDataList(DataInfosSeq& data, DataInfosSeq& out)
+{
+    assert(out.empty());
+    out.clear();
+
+    unsigned long long milliseconds = 0U;
+    if (1U <= m_state->m_debugLevel) {
+        for (auto& dataPtr : data) {
+            milliseconds = debugTimestamp(*dataPtr);
+            std::cout << '[' << milliseconds << "] (" << debugNameImpl() << ") <-- " << dataPtr->m_data.size() << " bytes";
+            if (2U <= m_state->m_debugLevel) {
+                std::cout << " | " << dataToStr(dataPtr->m_data);
+            }
+            std::cout << std::endl;
         }
-        std::cout << std::endl;
     }
 
-    auto result = recvDataImpl(std::move(dataPtr));
+    recvDataListImpl(data, out);
+    data.clear();
+
     if (1U <= m_state->m_debugLevel) {
-        for (auto& resultDataPtr : result) {
+        for (auto& resultDataPtr : out) {
             std::cout << '[' << milliseconds << "] " << resultDataPtr->m_data.size() << " bytes <-- (" << debugNameImpl() << ")";
             if (2U <= m_state->m_debugLevel) {
                 std::cout << " | " << dataToStr(resultDataPtr->m_data);
@@ -94,31 +135,30 @@ QList<ToolsDataInfoPtr> ToolsFilter::recvData(ToolsDataInfoPtr dataPtr)
             std::cout << std::endl;
         }
     }
-    return result;
 }
 
-QList<ToolsDataInfoPtr> ToolsFilter::sendData(ToolsDataInfoPtr dataPtr)
+void ToolsFilter::sendDataList(DataInfosSeq& data, DataInfosSeq& out)
 {
-    unsigned long long milliseconds = 0U;
+    assert(out.empty());
+    out.clear();
 
+    unsigned long long milliseconds = 0U;
     if (0U < m_state->m_debugLevel) {
-        auto timestamp = dataPtr->m_timestamp;
-        if (timestamp == ToolsDataInfo::Timestamp()) {
-            timestamp = ToolsDataInfo::TimestampClock::now();
-        }
-
-        auto sinceEpoch = timestamp.time_since_epoch();
-        milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
-        std::cout << '[' << milliseconds << "] " << dataPtr->m_data.size() << " bytes --> (" << debugNameImpl() << ")";
-        if (1U < m_state->m_debugLevel) {
-            std::cout << " | " << dataToStr(dataPtr->m_data);
+        for (auto& dataPtr : data) {
+            milliseconds = debugTimestamp(*dataPtr);
+            std::cout << '[' << milliseconds << "] " << dataPtr->m_data.size() << " bytes --> (" << debugNameImpl() << ")";
+            if (1U < m_state->m_debugLevel) {
+                std::cout << " | " << dataToStr(dataPtr->m_data);
+            }
+            std::cout << std::endl;
         }
-        std::cout << std::endl;
     }
 
-    auto result = sendDataImpl(std::move(dataPtr));
+    sendDataListImpl(data, out);
+    data.clear();
+
     if (0U < m_state->m_debugLevel) {
-        for (auto& resultDataPtr : result) {
+        for (auto& resultDataPtr : out) {
             std::cout << '[' << milliseconds << "] (" << debugNameImpl() << ") --> " << resultDataPtr->m_data.size() << " bytes";
             if (1U < m_state->m_debugLevel) {
                 std::cout << " | " << dataToStr(resultDataPtr->m_data);
@@ -126,7 +166,6 @@ QList<ToolsDataInfoPtr> ToolsFilter::sendData(ToolsDataInfoPtr dataPtr)
             std::cout << std::endl;
         }
     }
-    return result;
 }
 
 void ToolsFilter::socketConnectionReport(bool connected)
@@ -144,6 +183,11 @@ void ToolsFilter::setDebugOutputLevel(unsigned level)
     m_state->m_debugLevel = level;
 }
 
+bool ToolsFilter::isConcurrentRecvSupported() const
+{
+    return m_state->m_concurrentRecvSupported;
+}
+
 bool ToolsFilter::startImpl()
 {
     return true;
@@ -167,6 +211,22 @@ QList<ToolsDataInfoPtr> ToolsFilter::sendDataImpl(ToolsDataInfoPtr dataPtr)
     return result;
 }
 
+void ToolsFilter::recvDataListImpl(DataInfosSeq& data, DataInfosSeq& out)
+{
+    for (auto& dataPtr : data) {
+        auto result = recvDataImpl(std::move(dataPtr));
+        out.insert(out.end(), result.begin(), result.end());
+    }
+}
+
+void ToolsFilter::sendDataListImpl(DataInfosSeq& data, DataInfosSeq& out)
+{
+    for (auto& dataPtr : data) {
+        auto result = sendDataImpl(std::move(dataPtr));
+        out.insert(out.end(), result.begin(), result.end());
+    }
+}
+
 void ToolsFilter::socketConnectionReportImpl([[maybe_unused]] bool connected)
 {
 }
@@ -194,6 +254,11 @@ unsigned ToolsFilter::getDebugOutputLevel() const
     return m_state->m_debugLevel;
 }
 
+void ToolsFilter::setConcurrentRecvSupported(bool supported)
+{
+    m_state->m_concurrentRecvSupported = supported;
+}
+
 void ToolsFilter::reportDataToSend(ToolsDataInfoPtr dataPtr)
 {
     if (0U < m_state->m_debugLevel) {
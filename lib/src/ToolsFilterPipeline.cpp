@@ -0,0 +1,343 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ToolsFilterPipeline.h"
+
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+// Limit of the batches waiting in the queue of every stage
+const std::size_t MaxQueuedBatches = 256U;
+
+// Limit of the batches reported to the owner thread, but not processed yet
+const std::size_t MaxPendingDeliveries = 256U;
+
+} // namespace
+
+ToolsFilterPipeline::ToolsFilterPipeline(const FiltersList& filters)
+{
+    m_stages.reserve(filters.size());
+    for (auto& filter : filters) {
+        assert(filter);
+        assert(filter->isConcurrentRecvSupported());
+        auto stage = std::make_unique<Stage>();
+        stage->m_filter = filter;
+        m_stages.push_back(std::move(stage));
+    }
+
+    // Started after all the stages are created, every stage pushes into the next one
+    for (std::size_t idx = 0U; idx < m_stages.size(); ++idx) {
+        m_stages[idx]->m_thread = std::thread([this, idx]() { stageThreadFunc(idx); });
+    }
+}
+
+ToolsFilterPipeline::~ToolsFilterPipeline() noexcept
+{
+    // The pending data is dropped
+    for (auto& stage : m_stages) {
+        {
+            std::lock_guard<std::mutex> guard(stage->m_lock);
+            stage->m_stop = true;
+        }
+
+        stage->m_cond.notify_all();
+        stage->m_notFullCond.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_deliveryLock);
+        m_deliveryStopped = true;
+    }
+
+    m_deliveryCond.notify_all();
+    m_deliveryNotFullCond.notify_all();
+
+    for (auto& stage : m_stages) {
+        if (stage->m_thread.joinable()) {
+            stage->m_thread.join();
+        }
+    }
+}
+
+void ToolsFilterPipeline::pushData(DataInfosSeq&& data)
+{
+    if (data.empty()) {
+        return;
+    }
+
+    Batch batch;
+    batch.m_data = std::move(data);
+    pushFirst(std::move(batch));
+}
+
+void ToolsFilterPipeline::pushSourceClosed(const QString& source)
+{
+    Batch batch;
+    batch.m_closedSource = source;
+    batch.m_sourceClosed = true;
+    pushFirst(std::move(batch));
+}
+
+void ToolsFilterPipeline::pushFirst(Batch&& batch)
+{
+    if (m_stages.empty()) {
+        BatchesList deliveries;
+        deliveries.push_back(std::move(batch));
+        reportDeliveries(deliveries);
+        return;
+    }
+
+    auto& stage = *m_stages.front();
+    while (true) {
+        {
+            std::lock_guard<std::mutex> guard(stage.m_lock);
+            if (stage.m_stop) {
+                return;
+            }
+
+            if (stage.m_queue.size() < MaxQueuedBatches) {
+                stage.m_queue.push_back(std::move(batch));
+                break;
+            }
+        }
+
+        // Dropping any data would break the decoding of the stream, the caller
+        // (and as the result the I/O socket reading) waits for the first stage
+        // to catch up. The last stage mustn't be blocked by the owner thread
+        // meanwhile, the reported data is processed right away.
+        BatchesList deliveries;
+        {
+            std::unique_lock<std::mutex> guard(m_deliveryLock);
+            m_deliveryCond.wait(
+                guard,
+                [this]()
+                {
+                    return m_deliveryStopped || m_firstStageDrained || (!m_deliveries.empty());
+                });
+
+            if (m_deliveryStopped) {
+                return;
+            }
+
+            m_firstStageDrained = false;
+            deliveries.swap(m_deliveries);
+        }
+
+        m_deliveryNotFullCond.notify_one();
+        reportDeliveries(deliveries);
+    }
+
+    stage.m_cond.notify_one();
+}
+
+void ToolsFilterPipeline::push(std::size_t stageIdx, Batch&& batch)
+{
+    if (m_stages.size() <= stageIdx) {
+        deliver(std::move(batch));
+        return;
+    }
+
+    auto& stage = *m_stages[stageIdx];
+    {
+        std::unique_lock<std::mutex> guard(stage.m_lock);
+        stage.m_notFullCond.wait(
+            guard,
+            [&stage]()
+            {
+                return stage.m_stop || (stage.m_queue.size() < MaxQueuedBatches);
+            });
+
+        if (stage.m_stop) {
+            return;
+        }
+
+        stage.m_queue.push_back(std::move(batch));
+    }
+
+    stage.m_cond.notify_one();
+}
+
+void ToolsFilterPipeline::stageThreadFunc(std::size_t stageIdx)
+{
+    assert(stageIdx < m_stages.size());
+    auto& stage = *m_stages[stageIdx];
+    BatchesList batches;
+    while (true) {
+        bool wasFull = false;
+        {
+            std::unique_lock<std::mutex> guard(stage.m_lock);
+            stage.m_cond.wait(
+                guard,
+                [&stage]()
+                {
+                    return stage.m_stop || (!stage.m_queue.empty());
+                });
+
+            if (stage.m_stop) {
+                break;
+            }
+
+            // Everything pending is taken at once to reduce the locking
+            wasFull = (MaxQueuedBatches <= stage.m_queue.size());
+            batches.swap(stage.m_queue);
+        }
+
+        if (stageIdx != 0U) {
+            stage.m_notFullCond.notify_one();
+        }
+        else if (wasFull) {
+            // The owner thread may wait for the space
+            {
+                std::lock_guard<std::mutex> guard(m_deliveryLock);
+                m_firstStageDrained = true;
+            }
+
+            m_deliveryCond.notify_one();
+        }
+
+        for (auto& batch : batches) {
+            if (!batch.m_sourceClosed) {
+                processBatch(stage, batch);
+                if (batch.m_data.empty()) {
+                    continue;
+                }
+            }
+
+            push(stageIdx + 1U, std::move(batch));
+        }
+
+        batches.clear();
+    }
+}
+
+void ToolsFilterPipeline::processBatch(Stage& stage, Batch& batch)
+{
+    // Every chunk is processed separately to keep the source and timestamp
+    // of the data it produces.
+    DataInfosSeq result;
+    auto& in = stage.m_in;
+    auto& out = stage.m_out;
+    for (auto& dataPtr : batch.m_data) {
+        if (!dataPtr) {
+            continue;
+        }
+
+        auto source = dataPtr->m_source;
+        auto timestamp = dataPtr->m_timestamp;
+
+        in.clear();
+        out.clear();
+        in.push_back(std::move(dataPtr));
+        stage.m_filter->recvDataList(in, out);
+        for (auto& f : out) {
+            if (!f) {
+                continue;
+            }
+
+            if (f->m_source.isEmpty()) {
+                f->m_source = source;
+            }
+
+            if (f->m_timestamp == ToolsDataInfo::Timestamp()) {
+                f->m_timestamp = timestamp;
+            }
+        }
+
+        result.insert(result.end(), std::make_move_iterator(out.begin()), std::make_move_iterator(out.end()));
+    }
+
+    out.clear();
+
+    batch.m_data.swap(result);
+}
+
+void ToolsFilterPipeline::deliver(Batch&& batch)
+{
+    bool wasEmpty = false;
+    {
+        std::unique_lock<std::mutex> guard(m_deliveryLock);
+        m_deliveryNotFullCond.wait(
+            guard,
+            [this]()
+            {
+                return m_deliveryStopped || (m_deliveries.size() < MaxPendingDeliveries);
+            });
+
+        if (m_deliveryStopped) {
+            return;
+        }
+
+        wasEmpty = m_deliveries.empty();
+        m_deliveries.push_back(std::move(batch));
+    }
+
+    m_deliveryCond.notify_one();
+
+    if (!wasEmpty) {
+        // Processing is already scheduled
+        return;
+    }
+
+    // The protocol decoding is performed by the thread that owns the pipeline
+    QMetaObject::invokeMethod(
+        this,
+        [this]()
+        {
+            processDeliveries();
+        },
+        Qt::QueuedConnection);
+}
+
+void ToolsFilterPipeline::processDeliveries()
+{
+    BatchesList deliveries;
+    {
+        std::lock_guard<std::mutex> guard(m_deliveryLock);
+        deliveries.swap(m_deliveries);
+    }
+
+    m_deliveryNotFullCond.notify_one();
+    reportDeliveries(deliveries);
+}
+
+void ToolsFilterPipeline::reportDeliveries(BatchesList& deliveries)
+{
+    for (auto& batch : deliveries) {
+        if (batch.m_sourceClosed) {
+            if (m_sourceClosedCallback) {
+                m_sourceClosedCallback(batch.m_closedSource);
+            }
+            continue;
+        }
+
+        if (m_dataReceivedCallback) {
+            m_dataReceivedCallback(std::move(batch.m_data));
+        }
+    }
+
+    deliveries.clear();
+}
+
+}  // namespace cc_tools_qt
@@ -0,0 +1,121 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "cc_tools_qt/ToolsFilter.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+// Runs every filter of the receive chain on its own thread. The stages are
+// connected by the single producer / single consumer queues which preserve
+// the order of the data. The output of the last stage is reported on
+// the thread that owns the pipeline object.
+// The queues are bounded and nothing is dropped: the stage threads wait for
+// the space in the next queue, while the owner thread pushing into the full
+// first queue waits as well (processing the output of the last stage
+// meanwhile). As the result the I/O socket is not read until the pipeline
+// catches up.
+// Only the filters declaring ToolsFilter::isConcurrentRecvSupported() are
+// allowed to be used.
+class ToolsFilterPipeline : public QObject
+{
+    Q_OBJECT
+public:
+    using FiltersList = std::vector<ToolsFilterPtr>;
+    using DataInfosSeq = ToolsFilter::DataInfosSeq;
+    using DataReceivedCallbackFunc = std::function<void (DataInfosSeq&& data)>;
+    using SourceClosedCallbackFunc = std::function<void (const QString& source)>;
+
+    explicit ToolsFilterPipeline(const FiltersList& filters);
+    ~ToolsFilterPipeline() noexcept;
+
+    template <typename TFunc>
+    void setDataReceivedCallbackFunc(TFunc&& func)
+    {
+        m_dataReceivedCallback = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setSourceClosedCallbackFunc(TFunc&& func)
+    {
+        m_sourceClosedCallback = std::forward<TFunc>(func);
+    }
+
+    void pushData(DataInfosSeq&& data);
+    void pushSourceClosed(const QString& source);
+
+private:
+    struct Batch
+    {
+        DataInfosSeq m_data;
+        QString m_closedSource; ///< Reported in order with the data
+        bool m_sourceClosed = false;
+    };
+
+    using BatchesList = std::deque<Batch>;
+
+    struct Stage
+    {
+        ToolsFilterPtr m_filter;
+        std::mutex m_lock;
+        std::condition_variable m_cond;
+        std::condition_variable m_notFullCond;
+        BatchesList m_queue;
+        bool m_stop = false;
+        std::thread m_thread;
+        DataInfosSeq m_in; ///< Used by the stage thread only
+        DataInfosSeq m_out; ///< Used by the stage thread only
+    };
+
+    using StagePtr = std::unique_ptr<Stage>;
+    using StagesList = std::vector<StagePtr>;
+
+    void pushFirst(Batch&& batch);
+    void push(std::size_t stageIdx, Batch&& batch);
+    void stageThreadFunc(std::size_t stageIdx);
+    void processBatch(Stage& stage, Batch& batch);
+    void deliver(Batch&& batch);
+    void processDeliveries();
+    void reportDeliveries(BatchesList& deliveries);
+
+    StagesList m_stages;
+    std::mutex m_deliveryLock;
+    std::condition_variable m_deliveryCond; ///< Waited by the owner thread
+    std::condition_variable m_deliveryNotFullCond; ///< Waited by the last stage thread
+    BatchesList m_deliveries;
+    bool m_firstStageDrained = false; ///< Space reported by the full first stage
+    bool m_deliveryStopped = false;
+    DataReceivedCallbackFunc m_dataReceivedCallback;
+    SourceClosedCallbackFunc m_sourceClosedCallback;
+};
+
+}  // namespace cc_tools_qt
@@ -66,5 +66,10 @@ ToolsFrame::DataSeq ToolsFrame::writeProtMsg(const void* protInterface)
     return writeProtMsgImpl(protInterface);
 }
 
+void ToolsFrame::clearRecycledMessages()
+{
+    clearRecycledMessagesImpl();
+}
+
 }  // namespace cc_tools_qt
 
@@ -19,9 +19,9 @@
 
 #include "cc_tools_qt/ToolsStaticSingleton.h"
 
-#include <QtCore/QVariant>
-
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 namespace cc_tools_qt
 {
@@ -56,7 +56,11 @@ const char* ToolsMessage::name() const
 
 bool ToolsMessage::refreshMsg()
 {
-    return refreshMsgImpl();
+    bool refreshed = refreshMsgImpl();
+    if (refreshed) {
+        invalidateFields();
+    }
+    return refreshed;
 }
 
 QString ToolsMessage::idAsString() const
@@ -69,14 +73,24 @@ qlonglong ToolsMessage::numericId() const
     return numericIdImpl();
 }
 
+bool ToolsMessage::hasId() const
+{
+    return hasIdImpl();
+}
+
 void ToolsMessage::reset()
 {
     resetImpl();
+    invalidateFields();
 }
 
 bool ToolsMessage::assign(const ToolsMessage& other)
 {
-    return assignImpl(other);
+    bool result = assignImpl(other);
+    if (result) {
+        invalidateFields();
+    }
+    return result;
 }
 
 bool ToolsMessage::isValid() const
@@ -91,7 +105,9 @@ ToolsMessage::DataSeq ToolsMessage::encodeData() const
 
 bool ToolsMessage::decodeData(const DataSeq& data)
 {
-    return decodeDataImpl(data);
+    bool result = decodeDataImpl(data);
+    invalidateFields();
+    return result;
 }
 
 ToolsMessage::Ptr ToolsMessage::clone() const
@@ -102,6 +118,7 @@ ToolsMessage::Ptr ToolsMessage::clone() const
 void ToolsMessage::assignProtMessage(void* protMsg)
 {
     assignProtMessageImpl(protMsg);
+    invalidateFields();
 }
 
 ToolsMessage::DataSeq ToolsMessage::encodeFramed(ToolsFrame& frame) const
@@ -123,15 +140,131 @@ ToolsMessage::FieldsList ToolsMessage::payloadFields()
     return payloadFieldsImpl();
 }
 
-ToolsMessage::ToolsMessage()
+ToolsMessage::FieldsListPtr ToolsMessage::cachedTransportFields()
+{
+    std::lock_guard<std::mutex> guard(m_fieldsLock);
+    if (!m_transportFields) {
+        m_transportFields = std::make_shared<FieldsList>(transportFields());
+    }
+
+    return m_transportFields;
+}
+
+ToolsMessage::FieldsListPtr ToolsMessage::cachedPayloadFields()
+{
+    std::lock_guard<std::mutex> guard(m_fieldsLock);
+    if (!m_payloadFields) {
+        m_payloadFields = std::make_shared<FieldsList>(payloadFields());
+    }
+
+    return m_payloadFields;
+}
+
+unsigned ToolsMessage::fieldsVersion() const
+{
+    return m_fieldsVersion.load(std::memory_order_acquire);
+}
+
+void ToolsMessage::invalidateFields()
+{
+    FieldsListPtr transportFieldsTmp;
+    FieldsListPtr payloadFieldsTmp;
+    {
+        std::lock_guard<std::mutex> guard(m_fieldsLock);
+        m_fieldsVersion.fetch_add(1U, std::memory_order_acq_rel);
+        transportFieldsTmp.swap(m_transportFields);
+        payloadFieldsTmp.swap(m_payloadFields);
+    }
+
+    // The wrappers (if not used elsewhere) are destructed outside the lock
+}
+
+const ToolsMessage::FieldDescriptorsList& ToolsMessage::fieldDescriptors() const
+{
+    return fieldDescriptorsImpl();
+}
+
+QVariant ToolsMessage::toolsProperty(const char* name) const
+{
+    auto iter = findToolsProperty(name);
+    if (iter == m_toolsProps.end()) {
+        return QVariant();
+    }
+
+    return iter->second;
+}
+
+void ToolsMessage::setToolsProperty(const char* name, QVariant&& value)
+{
+    assert(name != nullptr);
+    auto iter = findToolsProperty(name);
+    if (!value.isValid()) {
+        if (iter != m_toolsProps.end()) {
+            m_toolsProps.erase(iter);
+        }
+        return;
+    }
+
+    if (iter != m_toolsProps.end()) {
+        iter->second = std::move(value);
+        return;
+    }
+
+    m_toolsProps.emplace_back(name, std::move(value));
+}
+
+void ToolsMessage::clearToolsProperties()
+{
+    m_toolsProps.clear();
+}
+
+ToolsMessage::ToolsMessage() :
+    m_fieldsVersion(0U)
 {
     registerMetaTypesIfNeeded();
 }
 
 QString ToolsMessage::idAsStringImpl() const
 {
+    if (!hasIdImpl()) {
+        return QString();
+    }
+
     return QString("%1").arg(numericIdImpl());
 }
 
+bool ToolsMessage::hasIdImpl() const
+{
+    return true;
+}
+
+const ToolsMessage::FieldDescriptorsList& ToolsMessage::fieldDescriptorsImpl() const
+{
+    static const FieldDescriptorsList List;
+    return List;
+}
+
+ToolsMessage::ToolsPropertiesList::iterator ToolsMessage::findToolsProperty(const char* name)
+{
+    return
+        std::find_if(
+            m_toolsProps.begin(), m_toolsProps.end(),
+            [name](auto& elem)
+            {
+                return (elem.first == name) || (std::strcmp(elem.first, name) == 0);
+            });
+}
+
+ToolsMessage::ToolsPropertiesList::const_iterator ToolsMessage::findToolsProperty(const char* name) const
+{
+    return
+        std::find_if(
+            m_toolsProps.begin(), m_toolsProps.end(),
+            [name](auto& elem)
+            {
+                return (elem.first == name) || (std::strcmp(elem.first, name) == 0);
+            });
+}
+
 }  // namespace cc_tools_qt
 
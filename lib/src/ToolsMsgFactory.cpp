@@ -23,6 +23,15 @@
 
 namespace cc_tools_qt
 {
+
+namespace
+{
+
+// Total number of the released messages of all the types kept for recycling
+const std::size_t MaxRecycledMsgsCount = 4096U;
+
+} // namespace
+
 ToolsMsgFactory::~ToolsMsgFactory() = default;
 
 ToolsMessagePtr ToolsMsgFactory::createMessage(const QString& idAsString, unsigned idx)
@@ -46,6 +55,71 @@ ToolsMessagePtr ToolsMsgFactory::createMessage(const QString& idAsString, unsign
 }
 
 ToolsMessagePtr ToolsMsgFactory::createMessage(const qlonglong id, unsigned idx)
+{
+    auto* pool = findPool(id, idx);
+    if (pool == nullptr) {
+        return ToolsMessagePtr();
+    }
+
+    return pool->acquire();
+}
+
+ToolsMessagePtr ToolsMsgFactory::acquireMessage(const qlonglong id, unsigned idx)
+{
+    auto* pool = findPool(id, idx);
+    if (pool == nullptr) {
+        return ToolsMessagePtr();
+    }
+
+    return pool->acquire(false);
+}
+
+ToolsMessagesList ToolsMsgFactory::createAllMessages()
+{
+    createDefaultMessagesIfNeeded();
+    ToolsMessagesList result;
+    for (auto& m : m_defaultMsgs) {
+        assert(m);
+        result.push_back(m->clone());
+    }
+    return result;
+}
+
+void ToolsMsgFactory::clearRecycledMessages()
+{
+    for (auto& p : m_pools) {
+        assert(p);
+        p->clear();
+    }
+}
+
+ToolsMsgFactory::ToolsMsgFactory() :
+    m_poolsLimit(ToolsMsgPool::createLimit(MaxRecycledMsgsCount))
+{
+}
+
+void ToolsMsgFactory::createDefaultMessagesIfNeeded()
+{
+    if (!m_defaultMsgs.empty()) {
+        return;
+    }
+
+    m_defaultMsgs = createAllMessagesImpl();
+    m_pools.clear();
+    m_pools.reserve(m_defaultMsgs.size());
+    for (auto& m : m_defaultMsgs) {
+        assert(m);
+        m_pools.push_back(
+            std::make_unique<ToolsMsgPool>(
+                [defaultMsg = m.get()]()
+                {
+                    return defaultMsg->clone();
+                },
+                m_poolsLimit));
+    }
+}
+
+ToolsMsgPool* ToolsMsgFactory::findPool(const qlonglong id, unsigned idx)
 {
     createDefaultMessagesIfNeeded();
     auto lowerIter =
@@ -58,7 +132,7 @@ ToolsMessagePtr ToolsMsgFactory::createMessage(const qlonglong id, unsigned idx)
 
     if ((lowerIter == m_defaultMsgs.end()) ||
         ((*lowerIter)->numericId() != id)) {
-        return ToolsMessagePtr();
+        return nullptr;
     }
 
     auto upperIter =
@@ -71,32 +145,14 @@ ToolsMessagePtr ToolsMsgFactory::createMessage(const qlonglong id, unsigned idx)
 
     auto distance = static_cast<unsigned>(std::distance(lowerIter, upperIter));
     if (distance <= idx) {
-        return ToolsMessagePtr();
+        return nullptr;
     }
 
     auto iter = lowerIter + idx;
     assert(iter != m_defaultMsgs.end());
-    return (*iter)->clone();
-}
-
-ToolsMessagesList ToolsMsgFactory::createAllMessages()
-{
-    createDefaultMessagesIfNeeded();
-    ToolsMessagesList result;
-    for (auto& m : m_defaultMsgs) {
-        assert(m);
-        result.push_back(m->clone());
-    }
-    return result;
-}
-
-ToolsMsgFactory::ToolsMsgFactory() = default;
-
-void ToolsMsgFactory::createDefaultMessagesIfNeeded()
-{
-    if (m_defaultMsgs.empty()) {
-        m_defaultMsgs = createAllMessagesImpl();
-    }
+    auto poolIdx = static_cast<std::size_t>(std::distance(m_defaultMsgs.begin(), iter));
+    assert(poolIdx < m_pools.size());
+    return m_pools[poolIdx].get();
 }
 
 }  // namespace cc_tools_qt
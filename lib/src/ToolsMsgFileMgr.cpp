@@ -86,6 +86,20 @@ public:
     RepeatUnitsProp() : Base("repeat_units") {}
 };
 
+class DelayUsProp : public property::message::ToolsMsgPropBase<unsigned long long>
+{
+    using Base = property::message::ToolsMsgPropBase<unsigned long long>;
+public:
+    DelayUsProp() : Base("delay_us") {}
+};
+
+class RepeatUsProp : public property::message::ToolsMsgPropBase<unsigned long long>
+{
+    using Base = property::message::ToolsMsgPropBase<unsigned long long>;
+public:
+    RepeatUsProp() : Base("repeat_us") {}
+};
+
 class RepeatCountProp : public property::message::ToolsMsgPropBase<unsigned>
 {
     using Base = property::message::ToolsMsgPropBase<unsigned>;
@@ -366,6 +380,16 @@ QVariantList convertSendMsgList(
         RepeatUnitsProp().setTo(property::message::ToolsMsgRepeatDurationUnits().getFrom(*msg), msgInfoMap);
         RepeatCountProp().setTo(property::message::ToolsMsgRepeatCount().getFrom(*msg, 1U), msgInfoMap);
 
+        auto delayUs = property::message::ToolsMsgDelayUs().getFrom(*msg);
+        if (delayUs != 0U) {
+            DelayUsProp().setTo(delayUs, msgInfoMap);
+        }
+
+        auto repeatUs = property::message::ToolsMsgRepeatDurationUs().getFrom(*msg);
+        if (repeatUs != 0U) {
+            RepeatUsProp().setTo(repeatUs, msgInfoMap);
+        }
+
         auto comment = property::message::ToolsMsgComment().getFrom(*msg);
         if (!comment.isEmpty()) {
             CommentProp().setTo(comment, msgInfoMap);
@@ -402,9 +426,11 @@ ToolsMessagesList convertSendMsgList(
         auto repeatDuration = RepeatProp().getFrom(msgMap);
         auto repeatDurationUnits = RepeatUnitsProp().getFrom(msgMap);
         auto repeatCount = RepeatCountProp().getFrom(msgMap);
+        auto delayUs = DelayUsProp().getFrom(msgMap);
+        auto repeatDurationUs = RepeatUsProp().getFrom(msgMap);
         auto comment = CommentProp().getFrom(msgMap);
 
-        if ((repeatDuration == 0) && (repeatCount == 0)) {
+        if ((repeatDuration == 0) && (repeatDurationUs == 0) && (repeatCount == 0)) {
             repeatCount = 1;
 
             do {
@@ -437,6 +463,15 @@ ToolsMessagesList convertSendMsgList(
         property::message::ToolsMsgRepeatDuration().setTo(repeatDuration, *msg);
         property::message::ToolsMsgRepeatDurationUnits().setTo(std::move(repeatDurationUnits), *msg);
         property::message::ToolsMsgRepeatCount().setTo(repeatCount, *msg);
+
+        if (delayUs != 0U) {
+            property::message::ToolsMsgDelayUs().setTo(delayUs, *msg);
+        }
+
+        if (repeatDurationUs != 0U) {
+            property::message::ToolsMsgRepeatDurationUs().setTo(repeatDurationUs, *msg);
+        }
+
         property::message::ToolsMsgComment().setTo(comment, *msg);
 
         convertedList.push_back(std::move(msg));
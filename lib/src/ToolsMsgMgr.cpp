@@ -59,6 +59,11 @@ void ToolsMsgMgr::setRecvEnabled(bool enabled)
     m_impl->setRecvEnabled(enabled);
 }
 
+void ToolsMsgMgr::setFilterPipelineEnabled(bool enabled)
+{
+    m_impl->setFilterPipelineEnabled(enabled);
+}
+
 void ToolsMsgMgr::deleteMsg(ToolsMessagePtr msg)
 {
     m_impl->deleteMsg(std::move(msg));
@@ -89,6 +94,16 @@ void ToolsMsgMgr::addMsgs(const ToolsMessagesList& msgs, bool reportAdded)
     m_impl->addMsgs(msgs, reportAdded);
 }
 
+const ToolsMsgStats& ToolsMsgMgr::getStats() const
+{
+    return m_impl->getStats();
+}
+
+void ToolsMsgMgr::clearStats()
+{
+    m_impl->clearStats();
+}
+
 void ToolsMsgMgr::setSocket(ToolsSocketPtr socket)
 {
     m_impl->setSocket(std::move(socket));
@@ -120,5 +135,11 @@ void ToolsMsgMgr::setSocketConnectionStatusReportCallbackFunc(
     m_impl->setSocketConnectionStatusReportCallbackFunc(std::move(func));
 }
 
+void ToolsMsgMgr::setSocketWriteBlockedReportCallbackFunc(
+    SocketWriteBlockedReportCallbackFunc&& func)
+{
+    m_impl->setSocketWriteBlockedReportCallbackFunc(std::move(func));
+}
+
 }  // namespace cc_tools_qt
 
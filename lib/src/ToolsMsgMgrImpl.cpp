@@ -25,7 +25,6 @@
 
 #include <QtCore/QVariant>
 
-#include "comms/util/ScopeGuard.h"
 #include "cc_tools_qt/property/message.h"
 
 namespace cc_tools_qt
@@ -49,6 +48,23 @@ void updateMsgTimestamp(ToolsMessage& msg, const ToolsDataInfo::Timestamp& times
     property::message::ToolsMsgTimestamp().setTo(milliseconds.count(), msg);
 }
 
+std::size_t recvLength(const ToolsMessage& msg)
+{
+    auto rawDataMsg = property::message::ToolsMsgRawDataMsg().getFrom(msg);
+    if (!rawDataMsg) {
+        return 0U;
+    }
+
+    // The raw data message contains single raw data field, the size
+    // of its storage is the length of the received data.
+    auto& descriptors = rawDataMsg->fieldDescriptors();
+    if ((descriptors.size() == 1U) && (descriptors.front().m_dataFunc != nullptr)) {
+        return descriptors.front().m_dataFunc(*rawDataMsg).m_size;
+    }
+
+    return rawDataMsg->encodeData().size();
+}
+
 }  // namespace
 
 ToolsMsgMgrImpl::ToolsMsgMgrImpl()
@@ -74,6 +90,7 @@ void ToolsMsgMgrImpl::start()
     }
 
     m_running = true;
+    updateFilterPipeline();
 }
 
 void ToolsMsgMgrImpl::stop()
@@ -84,6 +101,10 @@ void ToolsMsgMgrImpl::stop()
         return;
     }
 
+    // The filters mustn't be used by the pipeline threads after being stopped
+    m_filterPipeline.reset();
+    m_filterPipelineStagesCount = 0U;
+
     for (auto& f : m_filters) {
         f->stop();
     }
@@ -121,6 +142,15 @@ ToolsProtocolPtr ToolsMsgMgrImpl::getProtocol() const
 void ToolsMsgMgrImpl::setRecvEnabled(bool enabled)
 {
     m_recvEnabled = enabled;
+    if (m_socket) {
+        m_socket->setDataReceivedReportEnabled(enabled);
+    }
+}
+
+void ToolsMsgMgrImpl::setFilterPipelineEnabled(bool enabled)
+{
+    m_filterPipelineEnabled = enabled;
+    updateFilterPipeline();
 }
 
 void ToolsMsgMgrImpl::deleteMsgs(const ToolsMessagesList& msgs)
@@ -146,6 +176,16 @@ void ToolsMsgMgrImpl::deleteMsgs(const ToolsMessagesList& msgs)
     m_allMsgs.erase(prevStoredIter, storedIter);
 }
 
+void ToolsMsgMgrImpl::deleteAllMsgs()
+{
+    m_allMsgs.clear();
+    if (m_protocol) {
+        // The messages still referenced elsewhere return to the pools
+        // later, but their number is limited.
+        m_protocol->clearRecycledMessages();
+    }
+}
+
 void ToolsMsgMgrImpl::deleteMsg(ToolsMessagePtr msg)
 {
     assert(!m_allMsgs.empty());
@@ -176,63 +216,114 @@ void ToolsMsgMgrImpl::sendMsgs(ToolsMessagesList&& msgs)
         return;
     }
 
+    msgs.remove(ToolsMessagePtr());
+    if (msgs.empty()) {
+        return;
+    }
+
+    // All the messages are encoded first and written to the socket at once
+    // to allow it to coalesce the writes.
+    ToolsSocket::DataInfosList allData;
+    std::vector<int> msgDataCounts;
+    msgDataCounts.reserve(msgs.size());
     for (auto& msgPtr : msgs) {
-        if (!msgPtr) {
-            continue;
-        }
+        msgDataCounts.push_back(encodeMsg(*msgPtr, allData));
+    }
 
-        auto updateMsgGuard =
-            comms::util::makeScopeGuard(
-                [this, &msgPtr]()
-                {
-                    updateInternalId(*msgPtr);
-                    property::message::ToolsMsgType().setTo(MsgType::Sent, *msgPtr);
-                    auto now = ToolsDataInfo::TimestampClock::now();
-                    updateMsgTimestamp(*msgPtr, now);
-                    m_allMsgs.push_back(msgPtr);
-                    reportMsgAdded(msgPtr);
-                });
-
-        auto dataInfoPtr = m_protocol->write(*msgPtr);
-        if (!dataInfoPtr) {
-            continue;
-        }
+    m_socket->sendDataList(allData);
 
-        QList <ToolsDataInfoPtr> data;
-        data.append(std::move(dataInfoPtr));
-        for (auto iter = m_filters.rbegin(); iter != m_filters.rend(); ++iter) {
-            auto& filter = *iter;
-            if (data.isEmpty()) {
-                break;
+    auto now = ToolsDataInfo::TimestampClock::now();
+    auto dataIter = allData.cbegin();
+    auto countIter = msgDataCounts.cbegin();
+    for (auto& msgPtr : msgs) {
+        assert(countIter != msgDataCounts.cend());
+        auto dataCount = *countIter;
+        ++countIter;
+
+        std::size_t sentBytes = 0U;
+        ToolsDataInfo::PropertiesMap extraProps;
+        for (auto idx = 0; idx < dataCount; ++idx) {
+            assert(dataIter != allData.cend());
+            auto& d = *dataIter;
+            ++dataIter;
+
+            sentBytes += d->m_data.size();
+            for (auto iter = d->m_extraProperties.cbegin(); iter != d->m_extraProperties.cend(); ++iter) {
+                extraProps.insert(iter.key(), iter.value());
             }
+        }
 
-            QList <ToolsDataInfoPtr> dataTmp;
-            for (auto& d : data) {
-                dataTmp.append(filter->sendData(d));
+        if (!extraProps.isEmpty()) {
+            auto map = property::message::ToolsMsgExtraInfo().getFrom(*msgPtr);
+            auto origMap = map;
+            for (auto iter = extraProps.cbegin(); iter != extraProps.cend(); ++iter) {
+                map.insert(iter.key(), iter.value());
             }
 
-            data.swap(dataTmp);
+            if (map != origMap) {
+                property::message::ToolsMsgExtraInfo().setTo(std::move(map), *msgPtr);
+                m_protocol->updateMessage(*msgPtr);
+            }
         }
 
-        if (data.isEmpty()) {
-            continue;
+        if (0 < dataCount) {
+            m_protocol->messageSentReport(msgPtr);
         }
 
-        for (auto& d : data) {
-            m_socket->sendData(d);
+        updateInternalId(*msgPtr);
+        property::message::ToolsMsgType().setTo(MsgType::Sent, *msgPtr);
+        updateMsgTimestamp(*msgPtr, now);
+        m_stats.update(*msgPtr, sentBytes);
+    }
 
-            if (!d->m_extraProperties.isEmpty()) {
-                auto map = property::message::ToolsMsgExtraInfo().getFrom(*msgPtr);
-                for (auto& key : d->m_extraProperties.keys()) {
-                    map.insert(key, d->m_extraProperties.value(key));
-                }
-                property::message::ToolsMsgExtraInfo().setTo(std::move(map), *msgPtr);
-                m_protocol->updateMessage(*msgPtr);
-            }
+    auto firstAddedIter = msgs.begin();
+    m_allMsgs.splice(m_allMsgs.end(), msgs);
+    for (auto iter = firstAddedIter; iter != m_allMsgs.end(); ++iter) {
+        reportMsgAdded(*iter);
+    }
+}
+
+int ToolsMsgMgrImpl::encodeMsg(ToolsMessage& msg, ToolsSocket::DataInfosList& out)
+{
+    auto dataInfoPtr = property::message::ToolsMsgFramedData().getFrom(msg);
+    if (dataInfoPtr) {
+        // Pre-encoded by the sender and shared between multiple messages,
+        // the filters need to receive a copy.
+        property::message::ToolsMsgFramedData().setTo(ToolsDataInfoPtr(), msg);
+        dataInfoPtr = std::make_shared<ToolsDataInfo>(*dataInfoPtr);
+        dataInfoPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+    }
+    else {
+        dataInfoPtr = m_protocol->write(msg);
+    }
+
+    if (!dataInfoPtr) {
+        return 0;
+    }
+
+    // The buffers are reused between the messages
+    auto& data = m_sendData;
+    auto& dataTmp = m_sendDataTmp;
+    data.clear();
+    data.push_back(std::move(dataInfoPtr));
+    for (auto iter = m_filters.rbegin(); iter != m_filters.rend(); ++iter) {
+        auto& filter = *iter;
+        if (data.empty()) {
+            break;
         }
 
-        m_protocol->messageSentReport(msgPtr);
+        dataTmp.clear();
+        filter->sendDataList(data, dataTmp);
+        data.swap(dataTmp);
     }
+
+    auto count = static_cast<int>(data.size());
+    for (auto& d : data) {
+        out.append(std::move(d));
+    }
+
+    data.clear();
+    return count;
 }
 
 void ToolsMsgMgrImpl::addMsgs(const ToolsMessagesList& msgs, bool reportAdded)
@@ -275,6 +366,11 @@ void ToolsMsgMgrImpl::setSocket(ToolsSocketPtr socket)
         this, &ToolsMsgMgrImpl::socketDataReceived
     );
 
+    connect(
+        socket.get(), &ToolsSocket::sigDataListReceivedReport,
+        this, &ToolsMsgMgrImpl::socketDataListReceived
+    );
+
     connect(
         socket.get(), &ToolsSocket::sigErrorReport,
         this, &ToolsMsgMgrImpl::socketErrorReport
@@ -285,6 +381,17 @@ void ToolsMsgMgrImpl::setSocket(ToolsSocketPtr socket)
         this, &ToolsMsgMgrImpl::socketConnectionReport
     );
 
+    connect(
+        socket.get(), &ToolsSocket::sigWriteBlockedReport,
+        this, &ToolsMsgMgrImpl::socketWriteBlockedReport
+    );
+
+    connect(
+        socket.get(), &ToolsSocket::sigSourceClosedReport,
+        this, &ToolsMsgMgrImpl::socketSourceClosed
+    );
+
+    socket->setDataReceivedReportEnabled(m_recvEnabled);
     m_socket = std::move(socket);
 }
 
@@ -349,6 +456,17 @@ void ToolsMsgMgrImpl::socketConnectionReport(bool connected)
     reportSocketConnectionStatus(connected);
 }
 
+void ToolsMsgMgrImpl::socketWriteBlockedReport(bool blocked)
+{
+    if (m_socket.get() != sender()) {
+        return;
+    }
+
+    if (m_socketWriteBlockedReportCallback) {
+        m_socketWriteBlockedReportCallback(blocked);
+    }
+}
+
 void ToolsMsgMgrImpl::socketDataReceived(ToolsDataInfoPtr dataInfoPtr)
 {
     if (m_socket.get() != sender()) {
@@ -359,36 +477,119 @@ void ToolsMsgMgrImpl::socketDataReceived(ToolsDataInfoPtr dataInfoPtr)
         return;
     }
 
-    QList<ToolsDataInfoPtr> data;
-    data.append(dataInfoPtr);
-    for (auto filt : m_filters) {
-        assert(filt);
+    if (m_filterPipeline) {
+        ToolsFilter::DataInfosSeq data;
+        data.push_back(std::move(dataInfoPtr));
+        m_filterPipeline->pushData(std::move(data));
+        return;
+    }
 
-        if (data.isEmpty()) {
-            return;
-        }
+    auto timestamp = dataInfoPtr->m_timestamp;
+    processReceivedMsgs(readReceivedData(std::move(dataInfoPtr)), timestamp);
+}
+
+void ToolsMsgMgrImpl::socketDataListReceived(const ToolsSocket::DataInfosList& dataList)
+{
+    if (m_socket.get() != sender()) {
+        return;
+    }
+
+    if ((!m_recvEnabled) || !(m_protocol)) {
+        return;
+    }
 
-        QList<ToolsDataInfoPtr> dataTmp;
-        for (auto& d : data) {
-            dataTmp.append(filt->recvData(d));
+    if (m_filterPipeline) {
+        m_filterPipeline->pushData(ToolsFilter::DataInfosSeq(dataList.begin(), dataList.end()));
+        return;
+    }
+
+    for (auto& dataInfoPtr : dataList) {
+        if (!dataInfoPtr) {
+            continue;
         }
 
-        data.swap(dataTmp);
+        processReceivedMsgs(readReceivedData(dataInfoPtr), dataInfoPtr->m_timestamp);
+    }
+}
+
+void ToolsMsgMgrImpl::socketSourceClosed(const QString& source)
+{
+    if ((m_socket.get() != sender()) || (!m_protocol)) {
+        return;
     }
 
-    if (data.isEmpty()) {
+    if (m_filterPipeline) {
+        // Must follow the data of the source still being filtered
+        m_filterPipeline->pushSourceClosed(source);
         return;
     }
 
+    closeSource(source);
+}
+
+void ToolsMsgMgrImpl::closeSource(const QString& source)
+{
+    if (!m_protocol) {
+        return;
+    }
+
+    // Flushes the incomplete data of the source and releases its decoding context
+    ToolsDataInfo dataInfo;
+    dataInfo.m_timestamp = ToolsDataInfo::TimestampClock::now();
+    dataInfo.m_source = source;
+    auto msgsList = m_protocol->read(dataInfo, true);
+    if (!m_recvEnabled) {
+        return;
+    }
+
+    processReceivedMsgs(std::move(msgsList), dataInfo.m_timestamp);
+}
+
+ToolsMessagesList ToolsMsgMgrImpl::readReceivedData(ToolsDataInfoPtr dataInfoPtr, std::size_t firstFilterIdx)
+{
+    auto source = dataInfoPtr->m_source;
+
+    // The buffers are reused between the received chunks
+    auto& data = m_recvData;
+    auto& dataTmp = m_recvDataTmp;
+    data.clear();
+    data.push_back(std::move(dataInfoPtr));
+    for (auto idx = firstFilterIdx; idx < m_filters.size(); ++idx) {
+        auto& filt = m_filters[idx];
+        assert(filt);
+
+        if (data.empty()) {
+            return ToolsMessagesList();
+        }
+
+        dataTmp.clear();
+        filt->recvDataList(data, dataTmp);
+        for (auto& f : dataTmp) {
+            // Keep the stream identity of the newly allocated data
+            if (f && f->m_source.isEmpty()) {
+                f->m_source = source;
+            }
+        }
+
+        data.swap(dataTmp);
+    }
+
     ToolsMessagesList msgsList;
-    while (!data.isEmpty()) {
-        auto nextDataPtr = data.front();
-        data.pop_front();
+    for (auto& d : data) {
+        if (!d) {
+            continue;
+        }
 
-        auto msgs = m_protocol->read(*nextDataPtr);
-        msgsList.insert(msgsList.end(), msgs.begin(), msgs.end());
+        auto msgs = m_protocol->read(*d);
+        msgsList.splice(msgsList.end(), msgs);
     }
 
+    data.clear();
+    return msgsList;
+}
+
+void ToolsMsgMgrImpl::processReceivedMsgs(ToolsMessagesList&& msgsList, const ToolsDataInfo::Timestamp& timestamp)
+{
     if (msgsList.empty()) {
         return;
     }
@@ -399,14 +600,15 @@ void ToolsMsgMgrImpl::socketDataReceived(ToolsDataInfoPtr dataInfoPtr)
         property::message::ToolsMsgType().setTo(MsgType::Received, *m);
 
         static const ToolsDataInfo::Timestamp DefaultTimestamp;
-        if (dataInfoPtr->m_timestamp != DefaultTimestamp) {
-            updateMsgTimestamp(*m, dataInfoPtr->m_timestamp);
+        if (timestamp != DefaultTimestamp) {
+            updateMsgTimestamp(*m, timestamp);
         }
         else {
             auto now = ToolsDataInfo::TimestampClock::now();
             updateMsgTimestamp(*m, now);
         }
 
+        m_stats.update(*m, recvLength(*m));
         m_protocol->messageReceivedReport(m);
         reportMsgAdded(m);
     }
@@ -414,6 +616,61 @@ void ToolsMsgMgrImpl::socketDataReceived(ToolsDataInfoPtr dataInfoPtr)
     m_allMsgs.splice(m_allMsgs.end(), std::move(msgsList));
 }
 
+void ToolsMsgMgrImpl::pipelineDataReceived(ToolsFilter::DataInfosSeq&& data)
+{
+    if ((!m_recvEnabled) || !(m_protocol)) {
+        return;
+    }
+
+    for (auto& dataInfoPtr : data) {
+        if (!dataInfoPtr) {
+            continue;
+        }
+
+        // The rest of the filters don't support running on other threads
+        auto timestamp = dataInfoPtr->m_timestamp;
+        processReceivedMsgs(readReceivedData(std::move(dataInfoPtr), m_filterPipelineStagesCount), timestamp);
+    }
+}
+
+void ToolsMsgMgrImpl::updateFilterPipeline()
+{
+    // Only the filters declaring the support can be executed on other threads.
+    auto stagesIter =
+        std::find_if(
+            m_filters.begin(), m_filters.end(),
+            [](auto& f)
+            {
+                return !f->isConcurrentRecvSupported();
+            });
+
+    auto stagesCount = static_cast<std::size_t>(std::distance(m_filters.begin(), stagesIter));
+    bool required = m_running && m_filterPipelineEnabled && (0U < stagesCount);
+    if (!required) {
+        m_filterPipeline.reset();
+        m_filterPipelineStagesCount = 0U;
+        return;
+    }
+
+    if (m_filterPipeline) {
+        return;
+    }
+
+    m_filterPipelineStagesCount = stagesCount;
+    m_filterPipeline = std::make_unique<ToolsFilterPipeline>(FiltersList(m_filters.begin(), stagesIter));
+    m_filterPipeline->setDataReceivedCallbackFunc(
+        [this](ToolsFilter::DataInfosSeq&& data)
+        {
+            pipelineDataReceived(std::move(data));
+        });
+
+    m_filterPipeline->setSourceClosedCallbackFunc(
+        [this](const QString& source)
+        {
+            closeSource(source);
+        });
+}
+
 void ToolsMsgMgrImpl::filterErrorReport(const QString& msg)
 {
     auto iter =
@@ -454,21 +711,19 @@ void ToolsMsgMgrImpl::filterDataToSendReport(ToolsDataInfoPtr dataInfoPtr)
     assert(filterIdx < m_filters.size());
     auto revIdx = m_filters.size() - filterIdx;
 
-    QList<ToolsDataInfoPtr> data;
-    data.append(std::move(dataInfoPtr));
+    // Can be reported while encoding a message, the buffers of encodeMsg() can't be used.
+    ToolsFilter::DataInfosSeq data;
+    data.push_back(std::move(dataInfoPtr));
+    ToolsFilter::DataInfosSeq dataTmp;
     for (auto iter = m_filters.rbegin() + static_cast<std::intmax_t>(revIdx); iter != m_filters.rend(); ++iter) {
 
-        if (data.isEmpty()) {
+        if (data.empty()) {
             break;
         }
 
-        auto nextFilter = *iter;
-
-        QList<ToolsDataInfoPtr> dataTmp;
-        for (auto& d : data) {
-            dataTmp.append(nextFilter->sendData(d));
-        }
-
+        auto& nextFilter = *iter;
+        dataTmp.clear();
+        nextFilter->sendDataList(data, dataTmp);
         data.swap(dataTmp);
     }
 
@@ -18,9 +18,14 @@
 #pragma once
 
 #include "cc_tools_qt/ToolsMsgMgr.h"
+#include "cc_tools_qt/ToolsMsgStats.h"
+
+#include "ToolsFilterPipeline.h"
 
 #include <QtCore/QObject>
 
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace cc_tools_qt
@@ -42,13 +47,11 @@ public:
     ToolsSocketPtr getSocket() const;
     ToolsProtocolPtr getProtocol() const;
     void setRecvEnabled(bool enabled);
+    void setFilterPipelineEnabled(bool enabled);
 
     void deleteMsg(ToolsMessagePtr msg);
     void deleteMsgs(const ToolsMessagesList& msgs);
-    void deleteAllMsgs()
-    {
-        m_allMsgs.clear();
-    }
+    void deleteAllMsgs();
 
     void sendMsgs(ToolsMessagesList&& msgs);
 
@@ -59,6 +62,16 @@ public:
 
     void addMsgs(const ToolsMessagesList& msgs, bool reportAdded);
 
+    const ToolsMsgStats& getStats() const
+    {
+        return m_stats;
+    }
+
+    void clearStats()
+    {
+        m_stats.clear();
+    }
+
     void setSocket(ToolsSocketPtr socket);
     void setProtocol(ToolsProtocolPtr protocol);
     void addFilter(ToolsFilterPtr filter);
@@ -66,6 +79,7 @@ public:
     using MsgAddedCallbackFunc = ToolsMsgMgr::MsgAddedCallbackFunc;
     using ErrorReportCallbackFunc = ToolsMsgMgr::ErrorReportCallbackFunc;
     using SocketConnectionStatusReportCallbackFunc = ToolsMsgMgr::SocketConnectionStatusReportCallbackFunc;
+    using SocketWriteBlockedReportCallbackFunc = ToolsMsgMgr::SocketWriteBlockedReportCallbackFunc;
 
     template <typename TFunc>
     void setMsgAddedCallbackFunc(TFunc&& func)
@@ -85,10 +99,19 @@ public:
         m_socketConnectionStatusReportCallback = std::forward<TFunc>(func);
     }
 
+    template <typename TFunc>
+    void setSocketWriteBlockedReportCallbackFunc(TFunc&& func)
+    {
+        m_socketWriteBlockedReportCallback = std::forward<TFunc>(func);
+    }
+
 private slots:
     void socketErrorReport(const QString& msg);
     void socketConnectionReport(bool connected);
+    void socketWriteBlockedReport(bool blocked);
     void socketDataReceived(ToolsDataInfoPtr dataInfoPtr);
+    void socketDataListReceived(const ToolsSocket::DataInfosList& dataList);
+    void socketSourceClosed(const QString& source);
     void filterErrorReport(const QString& msg);
     void filterDataToSendReport(ToolsDataInfoPtr dataInfoPtr);
     void protocolErrorReport(const QString& msg);
@@ -98,23 +121,38 @@ private:
     using MsgNumberType = unsigned long long;
     using FiltersList = std::vector<ToolsFilterPtr>;
 
+    int encodeMsg(ToolsMessage& msg, ToolsSocket::DataInfosList& out);
     void updateInternalId(ToolsMessage& msg);
+    ToolsMessagesList readReceivedData(ToolsDataInfoPtr dataInfoPtr, std::size_t firstFilterIdx = 0U);
+    void processReceivedMsgs(ToolsMessagesList&& msgsList, const ToolsDataInfo::Timestamp& timestamp);
+    void pipelineDataReceived(ToolsFilter::DataInfosSeq&& data);
+    void closeSource(const QString& source);
+    void updateFilterPipeline();
     void reportMsgAdded(ToolsMessagePtr msg);
     void reportError(const QString& error);
     void reportSocketConnectionStatus(bool connected);
 
     ToolsMessagesList m_allMsgs;
+    ToolsMsgStats m_stats;
     bool m_recvEnabled = false;
 
     ToolsSocketPtr m_socket;
     ToolsProtocolPtr m_protocol;
     FiltersList m_filters;
+    ToolsFilter::DataInfosSeq m_recvData;
+    ToolsFilter::DataInfosSeq m_recvDataTmp;
+    ToolsFilter::DataInfosSeq m_sendData;
+    ToolsFilter::DataInfosSeq m_sendDataTmp;
+    std::unique_ptr<ToolsFilterPipeline> m_filterPipeline;
+    std::size_t m_filterPipelineStagesCount = 0U; ///< Leading filters run by the pipeline
+    bool m_filterPipelineEnabled = false;
     MsgNumberType m_nextMsgNum = 1;
     bool m_running = false;
 
     MsgAddedCallbackFunc m_msgAddedCallback;
     ErrorReportCallbackFunc m_errorReportCallback;
     SocketConnectionStatusReportCallbackFunc m_socketConnectionStatusReportCallback;
+    SocketWriteBlockedReportCallbackFunc m_socketWriteBlockedReportCallback;
 };
 
 }  // namespace cc_tools_qt
@@ -0,0 +1,166 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "cc_tools_qt/ToolsMsgPool.h"
+
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+struct ToolsMsgPool::Limit
+{
+    explicit Limit(std::size_t maxSize) : m_maxSize(maxSize) {}
+
+    const std::size_t m_maxSize = 0U;
+    std::atomic<std::size_t> m_count{0U};
+};
+
+namespace
+{
+
+bool reserveSlot(ToolsMsgPool::Limit& limit)
+{
+    auto count = limit.m_count.load();
+    while (count < limit.m_maxSize) {
+        if (limit.m_count.compare_exchange_weak(count, count + 1U)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void releaseSlots(ToolsMsgPool::Limit& limit, std::size_t count)
+{
+    if (count == 0U) {
+        return;
+    }
+
+    [[maybe_unused]] auto prevCount = limit.m_count.fetch_sub(count);
+    assert(count <= prevCount);
+}
+
+} // namespace
+
+struct ToolsMsgPool::State
+{
+    using MessagesList = std::vector<ToolsMessage::Ptr>;
+
+    ~State() noexcept
+    {
+        releaseSlots(*m_limit, m_free.size());
+    }
+
+    CreateFunc m_createFunc;
+    LimitPtr m_limit;
+    mutable std::mutex m_lock;
+    MessagesList m_free;
+};
+
+ToolsMsgPool::ToolsMsgPool(CreateFunc&& func, std::size_t maxSize) :
+    ToolsMsgPool(std::move(func), createLimit(maxSize))
+{
+}
+
+ToolsMsgPool::ToolsMsgPool(CreateFunc&& func, LimitPtr limit) :
+    m_state(std::make_shared<State>())
+{
+    assert(func);
+    assert(limit);
+    m_state->m_createFunc = std::move(func);
+    m_state->m_limit = std::move(limit);
+}
+
+ToolsMsgPool::~ToolsMsgPool() noexcept = default;
+
+ToolsMsgPool::LimitPtr ToolsMsgPool::createLimit(std::size_t maxSize)
+{
+    return std::make_shared<Limit>(maxSize);
+}
+
+ToolsMessagePtr ToolsMsgPool::acquire(bool resetContents)
+{
+    ToolsMessage::Ptr msg;
+    {
+        std::lock_guard<std::mutex> guard(m_state->m_lock);
+        if (!m_state->m_free.empty()) {
+            msg = std::move(m_state->m_free.back());
+            m_state->m_free.pop_back();
+        }
+    }
+
+    if (msg) {
+        releaseSlots(*m_state->m_limit, 1U);
+        if (resetContents) {
+            msg->reset();
+        }
+    }
+    else {
+        msg = m_state->m_createFunc();
+    }
+
+    if (!msg) {
+        return ToolsMessagePtr();
+    }
+
+    // The pool may be destroyed before the message is released
+    std::weak_ptr<State> weakState = m_state;
+    return
+        ToolsMessagePtr(
+            msg.release(),
+            [weakState](ToolsMessage* released)
+            {
+                ToolsMessage::Ptr releasedPtr(released);
+                auto state = weakState.lock();
+                if ((!state) || (!reserveSlot(*state->m_limit))) {
+                    return;
+                }
+
+                // Release the attached messages and data right away
+                // instead of keeping them until the next acquisition.
+                released->clearToolsProperties();
+                released->invalidateFields();
+
+                std::lock_guard<std::mutex> guard(state->m_lock);
+                state->m_free.push_back(std::move(releasedPtr));
+            });
+}
+
+void ToolsMsgPool::clear()
+{
+    State::MessagesList msgs;
+    {
+        std::lock_guard<std::mutex> guard(m_state->m_lock);
+        msgs.swap(m_state->m_free);
+    }
+
+    // Deleted outside the lock
+    releaseSlots(*m_state->m_limit, msgs.size());
+}
+
+std::size_t ToolsMsgPool::freeCount() const
+{
+    std::lock_guard<std::mutex> guard(m_state->m_lock);
+    return m_state->m_free.size();
+}
+
+}  // namespace cc_tools_qt
@@ -44,10 +44,30 @@ void ToolsMsgSendMgr::start(ToolsProtocolPtr protocol, const ToolsMessagesList&
     m_impl->start(std::move(protocol), msgs);
 }
 
+void ToolsMsgSendMgr::startBurst(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, unsigned count)
+{
+    m_impl->startBurst(std::move(protocol), msgs, count);
+}
+
 void ToolsMsgSendMgr::stop()
 {
     m_impl->stop();
 }
 
+void ToolsMsgSendMgr::setPaused(bool paused)
+{
+    m_impl->setPaused(paused);
+}
+
+bool ToolsMsgSendMgr::isPaused() const
+{
+    return m_impl->isPaused();
+}
+
+ToolsMsgSendMgr::TimingStatsList ToolsMsgSendMgr::getTimingStats() const
+{
+    return m_impl->getTimingStats();
+}
+
 }  // namespace cc_tools_qt
 
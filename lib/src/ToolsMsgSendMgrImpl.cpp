@@ -17,6 +17,7 @@
 
 #include "ToolsMsgSendMgrImpl.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "cc_tools_qt/property/message.h"
@@ -24,136 +25,531 @@
 namespace cc_tools_qt
 {
 
-ToolsMsgSendMgrImpl::ToolsMsgSendMgrImpl()
-  : m_timer(this)
+namespace
 {
-    connect(
-        &m_timer, &QTimer::timeout,
-        this, &ToolsMsgSendMgrImpl::sendPendingAndWait);
+
+// Number of messages passed to the send callback at once in the burst
+// mode before returning to the event loop to let the socket drain.
+const unsigned BurstChunkSize = 1024U;
+
+std::chrono::microseconds toDuration(unsigned long long ms, unsigned long long us)
+{
+    // The microseconds value is used only when consistent with the milliseconds one,
+    // i.e. the latter wasn't updated by someone unaware of the former.
+    if ((us != 0U) && ((us / 1000U) == ms)) {
+        return std::chrono::microseconds(us);
+    }
+
+    return std::chrono::milliseconds(ms);
+}
+
+std::chrono::microseconds msgDelay(const ToolsMessage& msg)
+{
+    return
+        toDuration(
+            property::message::ToolsMsgDelay().getFrom(msg),
+            property::message::ToolsMsgDelayUs().getFrom(msg));
+}
+
+std::chrono::microseconds msgRepeatDuration(const ToolsMessage& msg)
+{
+    return
+        toDuration(
+            property::message::ToolsMsgRepeatDuration().getFrom(msg),
+            property::message::ToolsMsgRepeatDurationUs().getFrom(msg));
+}
+
+unsigned long long toUs(std::chrono::steady_clock::duration value)
+{
+    auto count = std::chrono::duration_cast<std::chrono::microseconds>(value).count();
+    if (count < 0) {
+        return 0U;
+    }
+
+    return static_cast<unsigned long long>(count);
 }
 
-ToolsMsgSendMgrImpl::~ToolsMsgSendMgrImpl() noexcept = default;
+} // namespace
+
+ToolsMsgSendMgrImpl::ToolsMsgSendMgrImpl() = default;
+
+ToolsMsgSendMgrImpl::~ToolsMsgSendMgrImpl() noexcept
+{
+    stopTimingThread();
+}
 
 void ToolsMsgSendMgrImpl::start(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs)
 {
     [[maybe_unused]] static constexpr bool The_previous_sending_must_be_stopped_first = false;
-    assert(m_msgsToSend.empty() || The_previous_sending_must_be_stopped_first);
+    assert((m_scheduled.empty() && (m_burstRemaining == 0U)) || The_previous_sending_must_be_stopped_first);
     m_protocol = std::move(protocol);
+    m_stats.clear();
+    m_stats.reserve(msgs.size());
+    m_scheduled.reserve(msgs.size());
+
+    auto deadline = Clock::now();
+    if (m_paused) {
+        // The schedule starts now, the earlier pause must not delay it
+        m_pausedSince = deadline;
+    }
+
     for (auto& m : msgs) {
-        auto clonedMsg = m_protocol->cloneMessage(*m);
-        property::message::ToolsMsgDelay().copyFromTo(*m, *clonedMsg);
-        property::message::ToolsMsgDelayUnits().copyFromTo(*m, *clonedMsg);
-        property::message::ToolsMsgRepeatDuration().copyFromTo(*m, *clonedMsg);
-        property::message::ToolsMsgRepeatDurationUnits().copyFromTo(*m, *clonedMsg);
-        property::message::ToolsMsgRepeatCount().copyFromTo(*m, *clonedMsg);
-        property::message::ToolsMsgComment().copyFromTo(*m, *clonedMsg);
-        auto extraProps = property::message::ToolsMsgExtraInfo().getFrom(*m);
-        if (!extraProps.isEmpty()) {
-            property::message::ToolsMsgExtraInfo().setTo(std::move(extraProps), *clonedMsg);
-            m_protocol->updateMessage(*clonedMsg);
-            assert(!property::message::ToolsMsgExtraInfo().getFrom(*clonedMsg).isEmpty());
+        assert(m);
+        // The delay is relative to the previous message
+        deadline += msgDelay(*m);
+
+        StatsState state;
+        state.m_stats.m_name = m->name();
+
+        ScheduledMsg info;
+        info.m_msg = cloneMsg(*m);
+        info.m_deadline = deadline;
+        info.m_remainingCount = property::message::ToolsMsgRepeatCount().getFrom(*m, 1U);
+        info.m_period = msgRepeatDuration(*m);
+        info.m_statsIdx = m_stats.size();
+
+        if (info.m_remainingCount == 1U) {
+            info.m_period = Duration::zero();
+        }
+
+        if (Duration::zero() < info.m_period) {
+            // The repetitions are sent from the cache, the message cannot
+            // be modified while being sent, edit of the original one
+            // takes effect on the next start().
+            info.m_framedData = m_protocol->write(*info.m_msg);
         }
 
-        m_msgsToSend.push_back(std::move(clonedMsg));
+        state.m_stats.m_requestedPeriod = static_cast<unsigned long long>(info.m_period.count());
+        m_stats.push_back(std::move(state));
+        schedule(std::move(info));
     }
-    sendPendingAndWait();
+
+    sendDue();
+}
+
+void ToolsMsgSendMgrImpl::startBurst(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, unsigned count)
+{
+    [[maybe_unused]] static constexpr bool The_previous_sending_must_be_stopped_first = false;
+    assert((m_scheduled.empty() && (m_burstRemaining == 0U)) || The_previous_sending_must_be_stopped_first);
+    m_protocol = std::move(protocol);
+    m_stats.clear();
+    m_stats.reserve(msgs.size());
+    m_burstMsgs.clear();
+    m_burstMsgs.reserve(msgs.size());
+    for (auto& m : msgs) {
+        assert(m);
+        StatsState state;
+        state.m_stats.m_name = m->name();
+        m_stats.push_back(std::move(state));
+
+        BurstMsg info;
+        info.m_msg = cloneMsg(*m);
+        info.m_framedData = m_protocol->write(*info.m_msg);
+        m_burstMsgs.push_back(std::move(info));
+    }
+
+    m_burstIdx = 0U;
+    m_burstRemaining = static_cast<unsigned long long>(m_burstMsgs.size()) * count;
+    ++m_burstGeneration;
+    if (m_burstRemaining == 0U) {
+        m_burstMsgs.clear();
+        if (m_sendCompleteCallback) {
+            m_sendCompleteCallback();
+        }
+        return;
+    }
+
+    sendBurstChunk(m_burstGeneration);
 }
 
 void ToolsMsgSendMgrImpl::stop()
 {
-    m_timer.stop();
+    stopTimingThread();
     m_protocol.reset();
-    m_msgsToSend.clear();
+    m_scheduled.clear();
+    m_burstMsgs.clear();
+    m_burstRemaining = 0U;
+    ++m_burstGeneration;
+}
+
+void ToolsMsgSendMgrImpl::setPaused(bool paused)
+{
+    if (m_paused == paused) {
+        return;
+    }
+
+    m_paused = paused;
+    if (paused) {
+        m_pausedSince = Clock::now();
+        disarmTimer();
+        return;
+    }
+
+    if (!m_scheduled.empty()) {
+        // The same shift of all the deadlines keeps the heap order
+        auto pauseDuration = Clock::now() - m_pausedSince;
+        for (auto& info : m_scheduled) {
+            info.m_deadline += pauseDuration;
+        }
+
+        sendDue();
+    }
+
+    if (0U < m_burstRemaining) {
+        postBurstChunk();
+    }
 }
 
-void ToolsMsgSendMgrImpl::sendPendingAndWait()
+ToolsMsgSendMgrImpl::TimingStatsList ToolsMsgSendMgrImpl::getTimingStats() const
 {
-    m_timer.stop();
-    auto iter = m_msgsToSend.begin();
-    for (; iter != m_msgsToSend.end(); ++iter) {
-        auto& msg = *iter;
-        assert(msg);
-        auto delay = property::message::ToolsMsgDelay().getFrom(*msg);
-        if (delay != 0U) {
-            break;
+    TimingStatsList result;
+    result.reserve(m_stats.size());
+    for (auto& state : m_stats) {
+        result.push_back(state.m_stats);
+        auto& stats = result.back();
+        if (stats.m_count == 0U) {
+            continue;
+        }
+
+        stats.m_meanLateness =
+            static_cast<double>(state.m_totalLateness) / static_cast<double>(stats.m_count);
+
+        if (1U < stats.m_count) {
+            stats.m_achievedPeriod =
+                static_cast<double>(toUs(state.m_lastSend - state.m_firstSend)) /
+                static_cast<double>(stats.m_count - 1U);
         }
     }
 
-    decltype(m_msgsToSend) nextMsgsToSend;
-    nextMsgsToSend.splice(
-        nextMsgsToSend.end(), m_msgsToSend, m_msgsToSend.begin(), iter);
+    return result;
+}
 
-    for (auto& msgToSend : nextMsgsToSend) {
-        auto repeatMs = property::message::ToolsMsgRepeatDuration().getFrom(*msgToSend);
-        auto repeatCount = property::message::ToolsMsgRepeatCount().getFrom(*msgToSend, 1U);
+void ToolsMsgSendMgrImpl::schedule(ScheduledMsg&& info)
+{
+    info.m_seqNum = m_nextSeqNum;
+    ++m_nextSeqNum;
+    m_scheduled.push_back(std::move(info));
+    std::push_heap(m_scheduled.begin(), m_scheduled.end(), &ToolsMsgSendMgrImpl::scheduledLater);
+}
+
+ToolsMsgSendMgrImpl::ScheduledMsg ToolsMsgSendMgrImpl::popScheduled()
+{
+    assert(!m_scheduled.empty());
+    std::pop_heap(m_scheduled.begin(), m_scheduled.end(), &ToolsMsgSendMgrImpl::scheduledLater);
+    auto info = std::move(m_scheduled.back());
+    m_scheduled.pop_back();
+    return info;
+}
+
+bool ToolsMsgSendMgrImpl::scheduledLater(const ScheduledMsg& first, const ScheduledMsg& second)
+{
+    if (first.m_deadline != second.m_deadline) {
+        return second.m_deadline < first.m_deadline;
+    }
+
+    return second.m_seqNum < first.m_seqNum;
+}
+
+ToolsMessagePtr ToolsMsgSendMgrImpl::cloneMsg(const ToolsMessage& msg)
+{
+    assert(m_protocol);
+    auto clonedMsg = m_protocol->cloneMessage(msg);
+    auto extraProps = property::message::ToolsMsgExtraInfo().getFrom(msg);
+    if (!extraProps.isEmpty()) {
+        property::message::ToolsMsgExtraInfo().setTo(std::move(extraProps), *clonedMsg);
+        m_protocol->updateMessage(*clonedMsg);
+        assert(!property::message::ToolsMsgExtraInfo().getFrom(*clonedMsg).isEmpty());
+    }
+
+    return clonedMsg;
+}
+
+ToolsMessagePtr ToolsMsgSendMgrImpl::repeatMsg(const ToolsMessage& msg)
+{
+    // The repetition is identical to the previous instance, there is
+    // no need to encode it again to populate the transport and raw data
+    // details, which can be shared.
+    auto repeatedMsg = msg.clone();
+    if (!repeatedMsg) {
+        return repeatedMsg;
+    }
+
+    property::message::ToolsMsgProtocolName().copyFromTo(msg, *repeatedMsg);
+    property::message::ToolsMsgTransportMsg().copyFromTo(msg, *repeatedMsg);
+    property::message::ToolsMsgRawDataMsg().copyFromTo(msg, *repeatedMsg);
+    property::message::ToolsMsgExtraInfoMsg().copyFromTo(msg, *repeatedMsg);
+    property::message::ToolsMsgExtraInfo().copyFromTo(msg, *repeatedMsg);
+    property::message::ToolsMsgForceExtraInfoExistence().copyFromTo(msg, *repeatedMsg);
+    property::message::ToolsMsgComment().copyFromTo(msg, *repeatedMsg);
+    return repeatedMsg;
+}
+
+void ToolsMsgSendMgrImpl::timerExpired(unsigned long long generation)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_timerLock);
+        if (generation != m_timerGeneration) {
+            // Stopped or re-armed in the meantime
+            return;
+        }
+    }
+
+    sendDue();
+}
+
+void ToolsMsgSendMgrImpl::sendDue()
+{
+    if (m_paused) {
+        // Resumed by setPaused()
+        disarmTimer();
+        return;
+    }
+
+    auto now = Clock::now();
+    ToolsMessagesList msgsToSend;
+    while ((!m_scheduled.empty()) && (m_scheduled.front().m_deadline <= now)) {
+        auto info = popScheduled();
+        assert(info.m_msg);
+
+        recordSend(info.m_statsIdx, now, info.m_deadline);
 
         bool reinsert =
-            (0U < repeatMs) &&
-            ((repeatCount == 0U) || (1U < repeatCount));
+            (Duration::zero() < info.m_period) &&
+            ((info.m_remainingCount == 0U) || (1U < info.m_remainingCount));
 
         if (reinsert) {
-            if (!m_protocol) {
-                [[maybe_unused]] static constexpr bool Protocol_must_be_valid = false;
-                assert(Protocol_must_be_valid);
-                continue;
+            ScheduledMsg nextInfo;
+            nextInfo.m_msg = repeatMsg(*info.m_msg);
+            // Absolute deadlines do not accumulate the send latencies
+            nextInfo.m_deadline = info.m_deadline + info.m_period;
+            nextInfo.m_period = info.m_period;
+            nextInfo.m_remainingCount = info.m_remainingCount;
+            nextInfo.m_statsIdx = info.m_statsIdx;
+            nextInfo.m_framedData = info.m_framedData;
+            if (nextInfo.m_remainingCount != 0U) {
+                --nextInfo.m_remainingCount;
             }
 
-            auto newDelay = repeatMs;
-            auto reinsertIter =
-                std::find_if(
-                    m_msgsToSend.begin(), m_msgsToSend.end(),
-                    [&newDelay](ToolsMessagePtr mPtr) mutable -> bool
-                    {
-                        assert(mPtr);
-                        auto mDelay = property::message::ToolsMsgDelay().getFrom(*mPtr);
-                        if (newDelay < mDelay) {
-                            return true;
-                        }
-                        newDelay -= mDelay;
-                        return false;
-                    });
-
-            if (reinsertIter != m_msgsToSend.end()) {
-                auto& msgToUpdate = *reinsertIter;
-                assert(msgToUpdate);
-                auto mDelay = property::message::ToolsMsgDelay().getFrom(*msgToUpdate);
-                property::message::ToolsMsgDelay().setTo(mDelay - newDelay, *msgToUpdate);
+            if (nextInfo.m_deadline <= now) {
+                // Fell behind (e.g. the event loop was busy), the missed
+                // repetitions are skipped rather than sent back-to-back
+                // to catch up.
+                auto missed =
+                    static_cast<unsigned long long>((now - nextInfo.m_deadline) / info.m_period) + 1U;
+
+                if ((nextInfo.m_remainingCount != 0U) && (nextInfo.m_remainingCount <= missed)) {
+                    missed = nextInfo.m_remainingCount;
+                    reinsert = false;
+                }
+                else if (nextInfo.m_remainingCount != 0U) {
+                    nextInfo.m_remainingCount -= static_cast<unsigned>(missed);
+                }
+
+                nextInfo.m_deadline += info.m_period * static_cast<Duration::rep>(missed);
+                recordMissed(info.m_statsIdx, missed);
             }
 
-            auto clonedMsg = m_protocol->cloneMessage(*msgToSend);
-            auto extraProps = property::message::ToolsMsgExtraInfo().getFrom(*msgToSend);
-            if (!extraProps.isEmpty()) {
-                property::message::ToolsMsgExtraInfo().setTo(std::move(extraProps), *clonedMsg);
-                m_protocol->updateMessage(*clonedMsg);
+            if (reinsert) {
+                schedule(std::move(nextInfo));
             }
+        }
+
+        if (info.m_framedData) {
+            property::message::ToolsMsgFramedData().setTo(info.m_framedData, *info.m_msg);
+        }
+
+        msgsToSend.push_back(std::move(info.m_msg));
+    }
 
-            std::swap(clonedMsg, msgToSend);
-            property::message::ToolsMsgDelay().setTo(newDelay, *clonedMsg);
+    if (m_scheduled.empty()) {
+        stopTimingThread();
+    }
+    else {
+        armTimer();
+    }
+
+    if ((!msgsToSend.empty()) && m_sendCallback) {
+        m_sendCallback(std::move(msgsToSend));
+    }
 
-            if (repeatCount != 0) {
-                property::message::ToolsMsgRepeatCount().setTo(repeatCount - 1, *clonedMsg);
+    if (m_scheduled.empty() && m_sendCompleteCallback) {
+        m_sendCompleteCallback();
+    }
+}
+
+void ToolsMsgSendMgrImpl::recordSend(std::size_t statsIdx, TimePoint now, TimePoint deadline)
+{
+    assert(statsIdx < m_stats.size());
+    auto& state = m_stats[statsIdx];
+    auto lateness = toUs(now - deadline);
+    if (state.m_stats.m_count == 0U) {
+        state.m_firstSend = now;
+    }
+    state.m_lastSend = now;
+    state.m_totalLateness += lateness;
+    state.m_stats.m_maxLateness = std::max(state.m_stats.m_maxLateness, lateness);
+    ++state.m_stats.m_count;
+}
+
+void ToolsMsgSendMgrImpl::recordMissed(std::size_t statsIdx, unsigned long long count)
+{
+    assert(statsIdx < m_stats.size());
+    m_stats[statsIdx].m_stats.m_missedCount += count;
+}
+
+void ToolsMsgSendMgrImpl::sendBurstChunk(unsigned long long generation)
+{
+    if (generation != m_burstGeneration) {
+        // Stopped in the meantime
+        return;
+    }
+
+    if (m_paused || (m_burstRemaining == 0U)) {
+        // Resumed by setPaused() or stopped
+        return;
+    }
+
+    auto now = Clock::now();
+    ToolsMessagesList msgsToSend;
+    for (auto idx = 0U; (idx < BurstChunkSize) && (0U < m_burstRemaining); ++idx) {
+        assert(m_burstIdx < m_burstMsgs.size());
+        auto& info = m_burstMsgs[m_burstIdx];
+        auto msg = repeatMsg(*info.m_msg);
+        if (msg) {
+            if (info.m_framedData) {
+                property::message::ToolsMsgFramedData().setTo(info.m_framedData, *msg);
             }
 
-            m_msgsToSend.insert(reinsertIter, std::move(clonedMsg));
+            recordSend(m_burstIdx, now, now);
+            msgsToSend.push_back(std::move(msg));
+        }
+
+        --m_burstRemaining;
+        ++m_burstIdx;
+        if (m_burstMsgs.size() <= m_burstIdx) {
+            m_burstIdx = 0U;
         }
     }
 
-    if (!m_msgsToSend.empty()) {
-        auto& msg = m_msgsToSend.front();
-        assert(msg);
-        auto delay = property::message::ToolsMsgDelay().getFrom(*msg);
-        assert(0 < delay);
-        property::message::ToolsMsgDelay().setTo(0, *msg);
-        m_timer.setSingleShot(true);
-        m_timer.start(static_cast<int>(delay));
+    if (0U < m_burstRemaining) {
+        // Let the event loop to process the socket writes before the next chunk
+        postBurstChunk();
+    }
+
+    if ((!msgsToSend.empty()) && m_sendCallback) {
+        m_sendCallback(std::move(msgsToSend));
     }
 
-    if ((!nextMsgsToSend.empty()) && m_sendCallback) {
-        m_sendCallback(std::move(nextMsgsToSend));
+    if ((m_burstRemaining != 0U) || (generation != m_burstGeneration)) {
+        return;
     }
 
-    if (m_msgsToSend.empty() && m_sendCompleteCallback) {
+    m_burstMsgs.clear();
+    if (m_sendCompleteCallback) {
         m_sendCompleteCallback();
     }
 }
+
+void ToolsMsgSendMgrImpl::postBurstChunk()
+{
+    if (m_burstChunkPosted) {
+        // The pending invocation continues the current burst
+        return;
+    }
+
+    m_burstChunkPosted = true;
+    QMetaObject::invokeMethod(
+        this,
+        [this]()
+        {
+            m_burstChunkPosted = false;
+            sendBurstChunk(m_burstGeneration);
+        },
+        Qt::QueuedConnection);
+}
+
+void ToolsMsgSendMgrImpl::armTimer()
+{
+    assert(!m_scheduled.empty());
+    startTimingThread();
+    {
+        std::lock_guard<std::mutex> guard(m_timerLock);
+        m_timerDeadline = m_scheduled.front().m_deadline;
+        m_timerArmed = true;
+        ++m_timerGeneration;
+    }
+
+    m_timerCond.notify_all();
+}
+
+void ToolsMsgSendMgrImpl::disarmTimer()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_timerLock);
+        m_timerArmed = false;
+        ++m_timerGeneration;
+    }
+
+    m_timerCond.notify_all();
+}
+
+void ToolsMsgSendMgrImpl::startTimingThread()
+{
+    if (m_timingThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_timerLock);
+        m_stopThread = false;
+    }
+
+    m_timingThread = std::thread([this]() { timingThreadFunc(); });
+}
+
+void ToolsMsgSendMgrImpl::stopTimingThread()
+{
+    disarmTimer();
+    if (!m_timingThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_timerLock);
+        m_stopThread = true;
+    }
+
+    m_timerCond.notify_all();
+    m_timingThread.join();
+}
+
+void ToolsMsgSendMgrImpl::timingThreadFunc()
+{
+    std::unique_lock<std::mutex> guard(m_timerLock);
+    while (!m_stopThread) {
+        if (!m_timerArmed) {
+            m_timerCond.wait(guard);
+            continue;
+        }
+
+        auto generation = m_timerGeneration;
+        if (Clock::now() < m_timerDeadline) {
+            // The queued invocation below adds the event loop latency
+            // anyway, no need for more precise wakeup than the condition wait.
+            m_timerCond.wait_until(guard, m_timerDeadline);
+            continue;
+        }
+
+        // The sending is performed by the thread that owns the socket
+        m_timerArmed = false;
+        QMetaObject::invokeMethod(
+            this,
+            [this, generation]()
+            {
+                timerExpired(generation);
+            },
+            Qt::QueuedConnection);
+    }
+}
+
 }  // namespace cc_tools_qt
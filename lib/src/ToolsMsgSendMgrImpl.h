@@ -21,9 +21,14 @@
 #include "cc_tools_qt/ToolsProtocol.h"
 
 #include <QtCore/QObject>
-#include <QtCore/QTimer>
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace cc_tools_qt
 {
@@ -34,6 +39,8 @@ class ToolsMsgSendMgrImpl : public QObject
 public:
     using SendMsgsCallbackFunc = ToolsMsgSendMgr::SendMsgsCallbackFunc;
     using SendCompleteCallbackFunc = ToolsMsgSendMgr::SendCompleteCallbackFunc;
+    using TimingStats = ToolsMsgSendMgr::TimingStats;
+    using TimingStatsList = ToolsMsgSendMgr::TimingStatsList;
 
     ToolsMsgSendMgrImpl();
     ~ToolsMsgSendMgrImpl() noexcept;
@@ -51,18 +58,94 @@ public:
     }
 
     void start(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs);
+    void startBurst(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, unsigned count);
 
     void stop();
 
-private slots:
-    void sendPendingAndWait();
+    void setPaused(bool paused);
+
+    bool isPaused() const
+    {
+        return m_paused;
+    }
+
+    TimingStatsList getTimingStats() const;
 
 private:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration = std::chrono::microseconds;
+
+    struct ScheduledMsg
+    {
+        ToolsMessagePtr m_msg;
+        TimePoint m_deadline;
+        Duration m_period = Duration::zero();
+        unsigned m_remainingCount = 0U; ///< 0 means infinite
+        std::size_t m_statsIdx = 0U;
+        ToolsDataInfoPtr m_framedData; ///< Cached encoding of the repeated message
+        unsigned long long m_seqNum = 0U; ///< Keeps FIFO order of the same deadlines
+    };
+
+    // Min-heap by the deadline
+    using ScheduledList = std::vector<ScheduledMsg>;
+
+    struct BurstMsg
+    {
+        ToolsMessagePtr m_msg;
+        ToolsDataInfoPtr m_framedData;
+    };
+
+    using BurstMsgsList = std::vector<BurstMsg>;
+
+    struct StatsState
+    {
+        TimingStats m_stats;
+        TimePoint m_firstSend;
+        TimePoint m_lastSend;
+        unsigned long long m_totalLateness = 0U;
+    };
+
+    void schedule(ScheduledMsg&& info);
+    ScheduledMsg popScheduled();
+    static bool scheduledLater(const ScheduledMsg& first, const ScheduledMsg& second);
+    ToolsMessagePtr cloneMsg(const ToolsMessage& msg);
+    static ToolsMessagePtr repeatMsg(const ToolsMessage& msg);
+    void timerExpired(unsigned long long generation);
+    void recordSend(std::size_t statsIdx, TimePoint now, TimePoint deadline);
+    void recordMissed(std::size_t statsIdx, unsigned long long count);
+    void sendBurstChunk(unsigned long long generation);
+    void postBurstChunk();
+    void sendDue();
+    void armTimer();
+    void disarmTimer();
+    void startTimingThread();
+    void stopTimingThread();
+    void timingThreadFunc();
+
     SendMsgsCallbackFunc m_sendCallback;
     SendCompleteCallbackFunc m_sendCompleteCallback;
     ToolsProtocolPtr m_protocol;
-    ToolsMessagesList m_msgsToSend;
-    QTimer m_timer;
+    ScheduledList m_scheduled;
+    unsigned long long m_nextSeqNum = 0U;
+    BurstMsgsList m_burstMsgs;
+    std::size_t m_burstIdx = 0U;
+    unsigned long long m_burstRemaining = 0U;
+    unsigned long long m_burstGeneration = 0U;
+    bool m_burstChunkPosted = false;
+    bool m_paused = false;
+    TimePoint m_pausedSince;
+    std::vector<StatsState> m_stats;
+
+    // Shared with the timing thread, which runs only while there are
+    // scheduled messages
+    std::mutex m_timerLock;
+    std::condition_variable m_timerCond;
+    TimePoint m_timerDeadline;
+    unsigned long long m_timerGeneration = 0U;
+    bool m_timerArmed = false;
+    bool m_stopThread = false;
+    std::thread m_timingThread;
 };
 
 }  // namespace cc_tools_qt
@@ -0,0 +1,168 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "cc_tools_qt/ToolsMsgStats.h"
+
+#include "cc_tools_qt/ToolsDataInfo.h"
+#include "cc_tools_qt/property/message.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <type_traits>
+#include <typeinfo>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const ToolsMsgStats::Timestamp MsInSec = 1000U;
+
+unsigned histogramBin(ToolsMsgStats::Timestamp interval)
+{
+    unsigned bin = 0U;
+    while ((interval != 0U) && (bin < (ToolsMsgStats::HistogramBinsCount - 1U))) {
+        interval >>= 1;
+        ++bin;
+    }
+    return bin;
+}
+
+} // namespace
+
+ToolsMsgStats::ToolsMsgStats() = default;
+ToolsMsgStats::~ToolsMsgStats() noexcept = default;
+
+void ToolsMsgStats::update(const ToolsMessage& msg, std::size_t length)
+{
+    auto type = static_cast<MsgType>(property::message::ToolsMsgType().getFrom(msg));
+    if (MsgType::NumOfValues <= type) {
+        [[maybe_unused]] static constexpr bool Invalid_type = false;
+        assert(Invalid_type);
+        return;
+    }
+
+    auto& typesMap = m_typesMaps[static_cast<unsigned>(type)];
+    auto iter = typesMap.find(std::type_index(typeid(msg)));
+    if (iter == typesMap.end()) {
+        TypeState state;
+        state.m_entry.m_name = msg.name();
+        state.m_entry.m_id = msg.idAsString();
+        state.m_entry.m_type = type;
+        iter = typesMap.emplace(std::type_index(typeid(msg)), m_states.size()).first;
+        m_states.push_back(std::move(state));
+    }
+
+    assert(iter->second < m_states.size());
+    auto& state = m_states[iter->second];
+    auto& entry = state.m_entry;
+    auto timestamp = property::message::ToolsMsgTimestamp().getFrom(msg);
+
+    if (entry.m_count == 0U) {
+        entry.m_firstTimestamp = timestamp;
+    }
+    else {
+        Timestamp interval = 0U;
+        if (entry.m_lastTimestamp < timestamp) {
+            interval = timestamp - entry.m_lastTimestamp;
+        }
+
+        ++entry.m_interArrival[histogramBin(interval)];
+    }
+
+    ++entry.m_count;
+    entry.m_bytes += length;
+    if (!msg.isValid()) {
+        ++entry.m_invalidCount;
+    }
+
+    entry.m_lastTimestamp = std::max(entry.m_lastTimestamp, timestamp);
+
+    auto sec = timestamp / MsInSec;
+    auto slot = static_cast<unsigned>(sec % RateSlotsCount);
+    if (state.m_slotSec[slot] != sec) {
+        state.m_slotSec[slot] = sec;
+        state.m_slotCount[slot] = 0U;
+    }
+    ++state.m_slotCount[slot];
+}
+
+void ToolsMsgStats::clear()
+{
+    for (auto& m : m_typesMaps) {
+        m.clear();
+    }
+    m_states.clear();
+}
+
+ToolsMsgStats::EntriesList ToolsMsgStats::snapshot(Timestamp now) const
+{
+    // Only the completed seconds are taken into account
+    auto nowSec = now / MsInSec;
+
+    EntriesList result;
+    result.reserve(m_states.size());
+    for (auto& state : m_states) {
+        result.push_back(state.m_entry);
+        auto& entry = result.back();
+        for (auto windowIdx = 0U; windowIdx < RateWindow_NumOfValues; ++windowIdx) {
+            auto windowSec = rateWindowSec(static_cast<RateWindow>(windowIdx));
+            assert(windowSec <= MaxRateWindowSec);
+
+            unsigned long long count = 0U;
+            for (auto slot = 0U; slot < RateSlotsCount; ++slot) {
+                auto slotSec = state.m_slotSec[slot];
+                if ((slotSec < nowSec) && ((nowSec - slotSec) <= windowSec)) {
+                    count += state.m_slotCount[slot];
+                }
+            }
+
+            entry.m_rates[windowIdx] = static_cast<double>(count) / static_cast<double>(windowSec);
+        }
+    }
+
+    return result;
+}
+
+ToolsMsgStats::Timestamp ToolsMsgStats::currentTimestamp()
+{
+    auto sinceEpoch = ToolsDataInfo::TimestampClock::now().time_since_epoch();
+    return static_cast<Timestamp>(std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count());
+}
+
+unsigned ToolsMsgStats::rateWindowSec(RateWindow window)
+{
+    static const unsigned Map[] = {
+        /* RateWindow_1sec */ 1U,
+        /* RateWindow_10sec */ 10U,
+        /* RateWindow_60sec */ 60U,
+    };
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == RateWindow_NumOfValues, "Invalid map");
+
+    if (RateWindow_NumOfValues <= window) {
+        [[maybe_unused]] static constexpr bool Invalid_window = false;
+        assert(Invalid_window);
+        return 1U;
+    }
+
+    return Map[window];
+}
+
+}  // namespace cc_tools_qt
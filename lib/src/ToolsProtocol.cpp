@@ -250,6 +250,8 @@ ToolsMessagePtr ToolsProtocol::cloneMessage(const ToolsMessage& msg)
             property::message::ToolsMsgDelayUnits().copyFromTo(src, dst);
             property::message::ToolsMsgRepeatDuration().copyFromTo(src, dst);
             property::message::ToolsMsgRepeatDurationUnits().copyFromTo(src, dst);
+            property::message::ToolsMsgDelayUs().copyFromTo(src, dst);
+            property::message::ToolsMsgRepeatDurationUs().copyFromTo(src, dst);
             property::message::ToolsMsgRepeatCount().copyFromTo(src, dst);
             property::message::ToolsMsgComment().copyFromTo(src, dst);
         };
@@ -334,6 +336,12 @@ void ToolsProtocol::applyInterPluginConfig(const QVariantMap& props)
     applyInterPluginConfigImpl(props);
 }
 
+void ToolsProtocol::clearRecycledMessages()
+{
+    assert(m_state->m_frame);
+    m_state->m_frame->clearRecycledMessages();
+}
+
 void ToolsProtocol::setDebugOutputLevel(unsigned level)
 {
     m_state->m_debugLevel = level;
@@ -17,6 +17,9 @@
 
 #include "cc_tools_qt/ToolsSocket.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -47,6 +50,22 @@ std::string dataToStr(const ToolsDataInfo::DataSeq& data)
     return stream.str();
 }
 
+struct MetaTypesRegistrator
+{
+    MetaTypesRegistrator()
+    {
+        qRegisterMetaType<ToolsSocket::DataInfosList>();
+    }
+};
+
+void registerMetaTypesIfNeeded()
+{
+    [[maybe_unused]] static const MetaTypesRegistrator Registrator;
+}
+
+const unsigned long long DefaultHighWatermark = 1024U * 1024U;
+const unsigned long long DefaultLowWatermark = 256U * 1024U;
+
 } // namespace
 
 struct ToolsSocket::InnerState
@@ -54,11 +73,16 @@ struct ToolsSocket::InnerState
     unsigned m_debugLevel = 0U;
     bool m_running = false;
     bool m_connected = false;
+    bool m_writeBlocked = false;
+    std::atomic<bool> m_dataReceivedReportEnabled{true}; // Can be checked by the I/O threads
+    unsigned long long m_highWatermark = DefaultHighWatermark;
+    unsigned long long m_lowWatermark = DefaultLowWatermark;
 };
 
 ToolsSocket::ToolsSocket() :
     m_state(std::make_unique<InnerState>())
 {
+    registerMetaTypesIfNeeded();
 }
 
 ToolsSocket::~ToolsSocket() noexcept = default;
@@ -95,6 +119,7 @@ void ToolsSocket::socketDisconnect()
 {
     socketDisconnectImpl();
     m_state->m_connected = false;
+    setWriteBlocked(false);
     emit sigConnectionStatusReport(m_state->m_connected);
 }
 
@@ -109,21 +134,64 @@ void ToolsSocket::sendData(ToolsDataInfoPtr dataPtr)
         return;
     }
 
-    if (dataPtr->m_timestamp == ToolsDataInfo::Timestamp()) {
-        dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+    prepareSentData(*dataPtr);
+    sendDataImpl(std::move(dataPtr));
+    checkHighWatermark();
+}
+
+void ToolsSocket::sendDataList(const DataInfosList& dataList)
+{
+    if ((!isSocketConnected()) || dataList.isEmpty()) {
+        return;
     }
 
-    if (1U < m_state->m_debugLevel) {
-        auto sinceEpoch = dataPtr->m_timestamp.time_since_epoch();
-        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
-        std::cout << '[' << milliseconds << "] " << debugPrefix() << " --> " << dataPtr->m_data.size() << " bytes";
-        if (2U < m_state->m_debugLevel) {
-            std::cout << " | " << dataToStr(dataPtr->m_data);
-        }
-        std::cout << std::endl;
+    for (auto& dataPtr : dataList) {
+        assert(dataPtr);
+        prepareSentData(*dataPtr);
     }
 
-    sendDataImpl(std::move(dataPtr));
+    sendDataListImpl(dataList);
+    checkHighWatermark();
+}
+
+unsigned long long ToolsSocket::pendingBytes() const
+{
+    return pendingBytesImpl();
+}
+
+unsigned long long ToolsSocket::droppedCount() const
+{
+    return droppedCountImpl();
+}
+
+void ToolsSocket::setWatermarks(unsigned long long high, unsigned long long low)
+{
+    [[maybe_unused]] static constexpr bool Low_watermark_must_be_less_than_high = false;
+    assert((high == 0U) || (low < high) || Low_watermark_must_be_less_than_high);
+    m_state->m_highWatermark = high;
+    m_state->m_lowWatermark = std::min(low, high);
+
+    if (m_state->m_writeBlocked) {
+        reportBytesWritten();
+        return;
+    }
+
+    checkHighWatermark();
+}
+
+unsigned long long ToolsSocket::highWatermark() const
+{
+    return m_state->m_highWatermark;
+}
+
+unsigned long long ToolsSocket::lowWatermark() const
+{
+    return m_state->m_lowWatermark;
+}
+
+bool ToolsSocket::isWriteBlocked() const
+{
+    return m_state->m_writeBlocked;
 }
 
 unsigned ToolsSocket::connectionProperties() const
@@ -136,6 +204,16 @@ void ToolsSocket::applyInterPluginConfig(const QVariantMap& props)
     applyInterPluginConfigImpl(props);
 }
 
+void ToolsSocket::setDataReceivedReportEnabled(bool enabled)
+{
+    m_state->m_dataReceivedReportEnabled = enabled;
+}
+
+bool ToolsSocket::isDataReceivedReportEnabled() const
+{
+    return m_state->m_dataReceivedReportEnabled;
+}
+
 void ToolsSocket::setDebugOutputLevel(unsigned level)
 {
     m_state->m_debugLevel = level;
@@ -159,6 +237,23 @@ void ToolsSocket::socketDisconnectImpl()
 {
 }
 
+void ToolsSocket::sendDataListImpl(const DataInfosList& dataList)
+{
+    for (auto& dataPtr : dataList) {
+        sendDataImpl(dataPtr);
+    }
+}
+
+unsigned long long ToolsSocket::pendingBytesImpl() const
+{
+    return 0U;
+}
+
+unsigned long long ToolsSocket::droppedCountImpl() const
+{
+    return 0U;
+}
+
 unsigned ToolsSocket::connectionPropertiesImpl() const
 {
     return 0U;
@@ -182,29 +277,103 @@ unsigned ToolsSocket::getDebugOutputLevel() const
     return m_state->m_debugLevel;
 }
 
-void ToolsSocket::reportDataReceived(ToolsDataInfoPtr dataPtr)
+QByteArray ToolsSocket::concatData(const DataInfosList& dataList)
 {
-    if (!m_state->m_running) {
-        return;
+    std::size_t totalSize = 0U;
+    for (auto& dataPtr : dataList) {
+        totalSize += dataPtr->m_data.size();
+    }
+
+    QByteArray result;
+    result.reserve(static_cast<int>(totalSize));
+    for (auto& dataPtr : dataList) {
+        result.append(reinterpret_cast<const char*>(dataPtr->m_data.data()), static_cast<int>(dataPtr->m_data.size()));
+    }
+
+    return result;
+}
+
+void ToolsSocket::prepareSentData(ToolsDataInfo& data)
+{
+    if (data.m_timestamp == ToolsDataInfo::Timestamp()) {
+        data.m_timestamp = ToolsDataInfo::TimestampClock::now();
+    }
+
+    if (1U < m_state->m_debugLevel) {
+        auto sinceEpoch = data.m_timestamp.time_since_epoch();
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
+        std::cout << '[' << milliseconds << "] " << debugPrefix() << " --> " << data.m_data.size() << " bytes";
+        if (2U < m_state->m_debugLevel) {
+            std::cout << " | " << dataToStr(data.m_data);
+        }
+        std::cout << std::endl;
     }
+}
 
-    if (dataPtr->m_timestamp == ToolsDataInfo::Timestamp()) {
-        dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+void ToolsSocket::prepareReceivedData(ToolsDataInfo& data)
+{
+    if (data.m_timestamp == ToolsDataInfo::Timestamp()) {
+        data.m_timestamp = ToolsDataInfo::TimestampClock::now();
     }
 
     if (1U <= m_state->m_debugLevel) {
-        auto sinceEpoch = dataPtr->m_timestamp.time_since_epoch();
+        auto sinceEpoch = data.m_timestamp.time_since_epoch();
         auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
-        std::cout << '[' << milliseconds << "] " << debugPrefix() << " <-- " << dataPtr->m_data.size() << " bytes";
+        std::cout << '[' << milliseconds << "] " << debugPrefix() << " <-- " << data.m_data.size() << " bytes";
         if (2U <= m_state->m_debugLevel) {
-            std::cout << " | " << dataToStr(dataPtr->m_data);
+            std::cout << " | " << dataToStr(data.m_data);
         }
         std::cout << std::endl;
     }
+}
+
+void ToolsSocket::checkHighWatermark()
+{
+    if (m_state->m_writeBlocked || (m_state->m_highWatermark == 0U)) {
+        return;
+    }
+
+    if (pendingBytes() < m_state->m_highWatermark) {
+        return;
+    }
+
+    setWriteBlocked(true);
+}
+
+void ToolsSocket::setWriteBlocked(bool blocked)
+{
+    if (m_state->m_writeBlocked == blocked) {
+        return;
+    }
+
+    m_state->m_writeBlocked = blocked;
+    emit sigWriteBlockedReport(blocked);
+}
+
+void ToolsSocket::reportDataReceived(ToolsDataInfoPtr dataPtr)
+{
+    if ((!m_state->m_running) || (!m_state->m_dataReceivedReportEnabled)) {
+        return;
+    }
 
+    prepareReceivedData(*dataPtr);
     emit sigDataReceivedReport(std::move(dataPtr));
 }
 
+void ToolsSocket::reportDataListReceived(DataInfosList dataList)
+{
+    if ((!m_state->m_running) || (!m_state->m_dataReceivedReportEnabled) || dataList.isEmpty()) {
+        return;
+    }
+
+    for (auto& dataPtr : dataList) {
+        assert(dataPtr);
+        prepareReceivedData(*dataPtr);
+    }
+
+    emit sigDataListReceivedReport(dataList);
+}
+
 void ToolsSocket::reportError(const QString& msg)
 {
     if (m_state->m_running) {
@@ -215,6 +384,7 @@ void ToolsSocket::reportError(const QString& msg)
 void ToolsSocket::reportDisconnected()
 {
     m_state->m_connected = false;
+    setWriteBlocked(false);
     emit sigConnectionStatusReport(false);
 }
 
@@ -223,4 +393,24 @@ void ToolsSocket::reportInterPluginConfig(const QVariantMap& props)
     emit sigInterPluginConfigReport(props);
 }
 
+void ToolsSocket::reportSourceClosed(const QString& source)
+{
+    if (m_state->m_running) {
+        emit sigSourceClosedReport(source);
+    }
+}
+
+void ToolsSocket::reportBytesWritten()
+{
+    if (!m_state->m_writeBlocked) {
+        return;
+    }
+
+    if ((m_state->m_highWatermark != 0U) && (m_state->m_lowWatermark < pendingBytes())) {
+        return;
+    }
+
+    setWriteBlocked(false);
+}
+
 }  // namespace cc_tools_qt
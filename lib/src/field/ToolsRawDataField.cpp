@@ -34,6 +34,11 @@ QString ToolsRawDataField::getValue() const
     return getValueImpl();
 }
 
+QString ToolsRawDataField::getFullValue() const
+{
+    return getFullValueImpl();
+}
+
 void ToolsRawDataField::setValue(const QString& val)
 {
     setValueImpl(val);
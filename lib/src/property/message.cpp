@@ -35,10 +35,13 @@ ToolsMsgRawDataMsg::ToolsMsgRawDataMsg() : Base("cc.msg_raw_data") {}
 ToolsMsgExtraInfoMsg::ToolsMsgExtraInfoMsg() : Base("cc.msg_extra_info") {}
 ToolsMsgExtraInfo::ToolsMsgExtraInfo() : Base("cc.msg_extra_info_map") {}
 ToolsMsgForceExtraInfoExistence::ToolsMsgForceExtraInfoExistence() : Base("cc.force_extra_info_exist") {}
+ToolsMsgFramedData::ToolsMsgFramedData() : Base("cc.msg_framed_data") {}
 ToolsMsgDelay::ToolsMsgDelay() : Base("cc.msg_delay") {}
 ToolsMsgDelayUnits::ToolsMsgDelayUnits() : Base("cc.msg_delay_units") {}
 ToolsMsgRepeatDuration::ToolsMsgRepeatDuration() : Base("cc.msg_repeat") {}
 ToolsMsgRepeatDurationUnits::ToolsMsgRepeatDurationUnits() : Base("cc.msg_repeat_units") {}
+ToolsMsgDelayUs::ToolsMsgDelayUs() : Base("cc.msg_delay_us") {}
+ToolsMsgRepeatDurationUs::ToolsMsgRepeatDurationUs() : Base("cc.msg_repeat_us") {}
 ToolsMsgRepeatCount::ToolsMsgRepeatCount() : Base("cc.msg_repeat_count") {}
 ToolsMsgScrollPos::ToolsMsgScrollPos() : Base("cc.msg_scroll_pos") {}
 ToolsMsgComment::ToolsMsgComment() : Base("cc.msg_comment") {}
@@ -22,6 +22,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <iostream>
+
+#ifdef __linux__
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#endif
 
 namespace cc_tools_qt
 {
@@ -53,6 +60,16 @@ SerialSocket::SerialSocket()
     connect(
         &m_serial, &QSerialPort::readyRead,
         this, &SerialSocket::performRead);
+
+    connect(
+        &m_serial, &QSerialPort::bytesWritten,
+        this, &SerialSocket::reportBytesWritten);
+
+    m_coalesceTimer.setSingleShot(true);
+    m_coalesceTimer.setTimerType(Qt::PreciseTimer);
+    connect(
+        &m_coalesceTimer, &QTimer::timeout,
+        this, &SerialSocket::flushCoalesced);
 }
 
 SerialSocket::~SerialSocket() noexcept = default;
@@ -73,6 +90,16 @@ bool SerialSocket::socketConnectImpl()
     m_serial.setStopBits(m_stopBits);
     m_serial.setFlowControl(m_flowControl);
 
+    if ((m_recvMode == RecvMode_LowLatency) && (!setLowLatency(true)) && (0U < getDebugOutputLevel())) {
+        // Not supported by some drivers (e.g. pseudo terminals), the reads are still reported immediately
+        std::cout << "WARNING: Failed to enable low latency mode of the serial port." << std::endl;
+    }
+
+    m_coalesced.clear();
+    if (m_recvMode == RecvMode_Throughput) {
+        m_coalesced.reserve(std::max(m_coalesceBytes, 1U));
+    }
+
     return true;
 }
 
@@ -81,6 +108,12 @@ void SerialSocket::socketDisconnectImpl()
     if (!m_serial.isOpen()) {
         return;
     }
+
+    flushCoalesced();
+    if (m_lowLatencySet) {
+        setLowLatency(false);
+    }
+
     m_serial.flush();
     m_serial.close();
 }
@@ -93,12 +126,29 @@ void SerialSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         static_cast<qint64>(dataPtr->m_data.size()));
 }
 
+void SerialSocket::sendDataListImpl(const DataInfosList& dataList)
+{
+    m_serial.write(concatData(dataList));
+}
+
+unsigned long long SerialSocket::pendingBytesImpl() const
+{
+    return static_cast<unsigned long long>(m_serial.bytesToWrite());
+}
+
 void SerialSocket::performRead()
 {
     assert(sender() == &m_serial);
 
+    // Taken as close to the read as possible
+    auto timestamp = ToolsDataInfo::TimestampClock::now();
+    if (m_recvMode == RecvMode_Throughput) {
+        readCoalesced(timestamp);
+        return;
+    }
+
     auto dataPtr = makeDataInfo();
-    dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+    dataPtr->m_timestamp = timestamp;
 
     auto dataSize = m_serial.bytesAvailable();
     dataPtr->m_data.resize(static_cast<std::size_t>(dataSize));
@@ -111,6 +161,88 @@ void SerialSocket::performRead()
     reportDataReceived(std::move(dataPtr));
 }
 
+void SerialSocket::flushCoalesced()
+{
+    m_coalesceTimer.stop();
+    if (m_coalesced.empty()) {
+        return;
+    }
+
+    // The coalescing buffer keeps its capacity for the next chunk
+    auto dataPtr = makeDataInfo();
+    dataPtr->m_timestamp = m_coalescedTimestamp;
+    dataPtr->m_data.assign(m_coalesced.begin(), m_coalesced.end());
+    m_coalesced.clear();
+    reportDataReceived(std::move(dataPtr));
+}
+
+void SerialSocket::readCoalesced(const ToolsDataInfo::Timestamp& timestamp)
+{
+    auto dataSize = m_serial.bytesAvailable();
+    if (dataSize <= 0) {
+        return;
+    }
+
+    if (m_coalesced.empty()) {
+        // The chunk is timestamped by the arrival of its first bytes
+        m_coalescedTimestamp = timestamp;
+    }
+
+    auto prevSize = m_coalesced.size();
+    m_coalesced.resize(prevSize + static_cast<std::size_t>(dataSize));
+    auto result =
+        m_serial.read(reinterpret_cast<char*>(&m_coalesced[prevSize]), dataSize);
+    m_coalesced.resize(prevSize + static_cast<std::size_t>(std::max<qint64>(result, 0)));
+
+    if (m_coalesced.empty()) {
+        return;
+    }
+
+    if (((0U < m_coalesceBytes) && (m_coalesceBytes <= m_coalesced.size())) || (m_coalesceUs == 0U)) {
+        flushCoalesced();
+        return;
+    }
+
+    if (m_coalesceTimer.isActive()) {
+        return;
+    }
+
+    // The timer has a millisecond resolution
+    auto timeout = std::chrono::ceil<std::chrono::milliseconds>(std::chrono::microseconds(m_coalesceUs));
+    m_coalesceTimer.start(timeout);
+}
+
+bool SerialSocket::setLowLatency([[maybe_unused]] bool enabled)
+{
+#ifdef __linux__
+    serial_struct serialInfo;
+    if (::ioctl(m_serial.handle(), TIOCGSERIAL, &serialInfo) != 0) {
+        return false;
+    }
+
+    bool wasEnabled = ((serialInfo.flags & ASYNC_LOW_LATENCY) != 0);
+    if (wasEnabled == enabled) {
+        return true;
+    }
+
+    if (enabled) {
+        serialInfo.flags |= ASYNC_LOW_LATENCY;
+    }
+    else {
+        serialInfo.flags &= ~ASYNC_LOW_LATENCY;
+    }
+
+    if (::ioctl(m_serial.handle(), TIOCSSERIAL, &serialInfo) != 0) {
+        return false;
+    }
+
+    m_lowLatencySet = enabled;
+    return true;
+#else // #ifdef __linux__
+    return false;
+#endif // #ifdef __linux__
+}
+
 void SerialSocket::errorOccurred(QSerialPort::SerialPortError err)
 {
     if (err == QSerialPort::NoError) {
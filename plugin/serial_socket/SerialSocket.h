@@ -21,6 +21,7 @@
 
 #include <QtSerialPort/QSerialPort>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 
 namespace cc_tools_qt
 {
@@ -43,6 +44,17 @@ public:
     using StopBits = QSerialPort::StopBits;
     using FlowControl = QSerialPort::FlowControl;
 
+    enum RecvMode : unsigned
+    {
+        RecvMode_Default, ///< Report the data as delivered by the driver
+        RecvMode_LowLatency, ///< Request immediate delivery from the driver, report every read
+        RecvMode_Throughput, ///< Coalesce the reads up to configured number of bytes or time
+        RecvMode_NumOfValues
+    };
+
+    static const unsigned DefaultCoalesceBytes = 4096U;
+    static const unsigned DefaultCoalesceUs = 1000U;
+
     SerialSocket();
     ~SerialSocket() noexcept;
 
@@ -76,23 +88,51 @@ public:
         return m_flowControl;
     }
 
+    RecvMode& recvMode()
+    {
+        return m_recvMode;
+    }
+
+    unsigned& coalesceBytes()
+    {
+        return m_coalesceBytes;
+    }
+
+    unsigned& coalesceUs()
+    {
+        return m_coalesceUs;
+    }
+
 protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const DataInfosList& dataList) override;
+    virtual unsigned long long pendingBytesImpl() const override;
 
 private slots:
     void performRead();
+    void flushCoalesced();
     void errorOccurred(QSerialPort::SerialPortError err);
 
 private:
+    void readCoalesced(const ToolsDataInfo::Timestamp& timestamp);
+    bool setLowLatency(bool enabled);
+
     QSerialPort m_serial;
+    QTimer m_coalesceTimer;
+    ToolsDataInfo::DataSeq m_coalesced;
+    ToolsDataInfo::Timestamp m_coalescedTimestamp;
     QString m_name;
     Baud m_baud = 115200;
     DataBits m_dataBits = DataBits::Data8;
     Parity m_parity = Parity::NoParity;
     StopBits m_stopBits = StopBits::OneStop;
     FlowControl m_flowControl = FlowControl::NoFlowControl;
+    RecvMode m_recvMode = RecvMode_Default;
+    unsigned m_coalesceBytes = DefaultCoalesceBytes; ///< 0 means no limit
+    unsigned m_coalesceUs = DefaultCoalesceUs;
+    bool m_lowLatencySet = false;
 };
 
 }  // namespace serial_socket
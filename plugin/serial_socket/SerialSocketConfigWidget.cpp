@@ -144,8 +144,12 @@ SerialSocketConfigWidget::SerialSocketConfigWidget(
     m_ui.m_parityComboBox->setCurrentIndex(mapParityToIdx(m_socket.parity()));
     m_ui.m_stopBitsComboBox->setCurrentIndex(mapStopBitToIdx(m_socket.stopBits()));
     m_ui.m_flowComboBox->setCurrentIndex(mapFlowControlToIdx(m_socket.flowControl()));
+    m_ui.m_recvModeComboBox->setCurrentIndex(static_cast<int>(m_socket.recvMode()));
+    m_ui.m_coalesceBytesSpinBox->setValue(static_cast<int>(m_socket.coalesceBytes()));
+    m_ui.m_coalesceUsSpinBox->setValue(static_cast<int>(m_socket.coalesceUs()));
 
     refreshDeviceConfig();
+    refreshCoalesceConfig();
 
     connect(
         m_ui.m_deviceLineEdit, &QLineEdit::textEdited,
@@ -186,6 +190,18 @@ SerialSocketConfigWidget::SerialSocketConfigWidget(
     connect(
         m_ui.m_flowComboBox, qOverload<int>(&QComboBox::currentIndexChanged),
         this, &SerialSocketConfigWidget::flowControlChanged);
+
+    connect(
+        m_ui.m_recvModeComboBox, qOverload<int>(&QComboBox::currentIndexChanged),
+        this, &SerialSocketConfigWidget::recvModeChanged);
+
+    connect(
+        m_ui.m_coalesceBytesSpinBox, qOverload<int>(&QSpinBox::valueChanged),
+        this, &SerialSocketConfigWidget::coalesceBytesChanged);
+
+    connect(
+        m_ui.m_coalesceUsSpinBox, qOverload<int>(&QSpinBox::valueChanged),
+        this, &SerialSocketConfigWidget::coalesceUsChanged);
 }
 
 SerialSocketConfigWidget::~SerialSocketConfigWidget() noexcept = default;
@@ -248,6 +264,28 @@ void SerialSocketConfigWidget::flowControlChanged(int value)
     m_socket.flowControl() = mapFlowControlFromIdx(value);
 }
 
+void SerialSocketConfigWidget::recvModeChanged(int value)
+{
+    if ((value < 0) || (SerialSocket::RecvMode_NumOfValues <= static_cast<unsigned>(value))) {
+        [[maybe_unused]] static constexpr bool Invalid_index = false;
+        assert(Invalid_index);
+        return;
+    }
+
+    m_socket.recvMode() = static_cast<SerialSocket::RecvMode>(value);
+    refreshCoalesceConfig();
+}
+
+void SerialSocketConfigWidget::coalesceBytesChanged(int value)
+{
+    m_socket.coalesceBytes() = static_cast<unsigned>(value);
+}
+
+void SerialSocketConfigWidget::coalesceUsChanged(int value)
+{
+    m_socket.coalesceUs() = static_cast<unsigned>(value);
+}
+
 void SerialSocketConfigWidget::refreshDeviceConfig()
 {
     m_ui.m_deviceComboBox->blockSignals(true);
@@ -280,6 +318,13 @@ void SerialSocketConfigWidget::refreshDeviceConfigComboSignalsBlocked()
     m_ui.m_deviceRefreshToolButton->setHidden(m_editMode);
 }
 
+void SerialSocketConfigWidget::refreshCoalesceConfig()
+{
+    bool enabled = (m_socket.recvMode() == SerialSocket::RecvMode_Throughput);
+    m_ui.m_coalesceBytesSpinBox->setEnabled(enabled);
+    m_ui.m_coalesceUsSpinBox->setEnabled(enabled);
+}
+
 }  // namespace serial_socket
 
 }  // namespace plugin
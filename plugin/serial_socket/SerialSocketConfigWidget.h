@@ -53,10 +53,14 @@ private slots:
     void parityChanged(int value);
     void stopBitsChanged(int value);
     void flowControlChanged(int value);
+    void recvModeChanged(int value);
+    void coalesceBytesChanged(int value);
+    void coalesceUsChanged(int value);
 
 private:
     void refreshDeviceConfig();
     void refreshDeviceConfigComboSignalsBlocked();
+    void refreshCoalesceConfig();
 
     SerialSocket& m_socket;
     Ui::SerialSocketConfigWidget m_ui;
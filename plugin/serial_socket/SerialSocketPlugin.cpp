@@ -42,6 +42,9 @@ const QString DataBitsSubKey("data_bits");
 const QString ParitySubKey("parity");
 const QString StopBitsSubKey("stop_bits");
 const QString FlowControlSubKey("flow");
+const QString RecvModeSubKey("recv_mode");
+const QString CoalesceBytesSubKey("coalesce_bytes");
+const QString CoalesceUsSubKey("coalesce_us");
 
 }  // namespace
 
@@ -63,6 +66,9 @@ void SerialSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(ParitySubKey, static_cast<int>(m_socket->parity()));
     subConfig.insert(StopBitsSubKey, static_cast<int>(m_socket->stopBits()));
     subConfig.insert(FlowControlSubKey, static_cast<int>(m_socket->flowControl()));
+    subConfig.insert(RecvModeSubKey, static_cast<unsigned>(m_socket->recvMode()));
+    subConfig.insert(CoalesceBytesSubKey, m_socket->coalesceBytes());
+    subConfig.insert(CoalesceUsSubKey, m_socket->coalesceUs());
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -122,6 +128,24 @@ void SerialSocketPlugin::reconfigureImpl(const QVariantMap& config)
             m_socket->flowControl() = flow;
         }
     }
+
+    auto recvModeVar = subConfig.value(RecvModeSubKey);
+    if (recvModeVar.isValid() && recvModeVar.canConvert<unsigned>()) {
+        auto recvMode = recvModeVar.value<unsigned>();
+        if (recvMode < SerialSocket::RecvMode_NumOfValues) {
+            m_socket->recvMode() = static_cast<SerialSocket::RecvMode>(recvMode);
+        }
+    }
+
+    auto coalesceBytesVar = subConfig.value(CoalesceBytesSubKey);
+    if (coalesceBytesVar.isValid() && coalesceBytesVar.canConvert<unsigned>()) {
+        m_socket->coalesceBytes() = coalesceBytesVar.value<unsigned>();
+    }
+
+    auto coalesceUsVar = subConfig.value(CoalesceUsSubKey);
+    if (coalesceUsVar.isValid() && coalesceUsVar.canConvert<unsigned>()) {
+        m_socket->coalesceUs() = coalesceUsVar.value<unsigned>();
+    }
 }
 
 ToolsSocketPtr SerialSocketPlugin::createSocketImpl()
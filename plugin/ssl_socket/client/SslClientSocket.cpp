@@ -94,6 +94,10 @@ SslClientSocket::SslClientSocket()
     connect(
         &m_socket, qOverload<const QList<QSslError>&>(&QSslSocket::sslErrors),
         this, &SslClientSocket::sslErrorsOccurred);
+
+    connect(
+        &m_socket, &QSslSocket::encryptedBytesWritten,
+        this, &SslClientSocket::reportBytesWritten);
 }
 
 SslClientSocket::~SslClientSocket() noexcept
@@ -174,16 +178,22 @@ void SslClientSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         reinterpret_cast<const char*>(&dataPtr->m_data[0]),
         static_cast<qint64>(dataPtr->m_data.size()));
 
-    QString from =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
-    QString to =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
+    setSentDataProps(DataInfosList{dataPtr});
+}
 
-    dataPtr->m_extraProperties.insert(sslFromProp(), from);
-    dataPtr->m_extraProperties.insert(sslToProp(), to);
+void SslClientSocket::sendDataListImpl(const DataInfosList& dataList)
+{
+    m_socket.write(concatData(dataList));
+    setSentDataProps(dataList);
+}
 
+unsigned long long SslClientSocket::pendingBytesImpl() const
+{
+    // Both plain data waiting for encryption and the encrypted one
+    // waiting to be written are queued.
+    return
+        static_cast<unsigned long long>(m_socket.bytesToWrite()) +
+        static_cast<unsigned long long>(m_socket.encryptedBytesToWrite());
 }
 
 void SslClientSocket::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -302,6 +312,21 @@ void SslClientSocket::sslErrorsOccurred(const QList<QSslError>& errs)
     }
 }
 
+void SslClientSocket::setSentDataProps(const DataInfosList& dataList)
+{
+    QString from =
+        m_socket.localAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.localPort());
+    QString to =
+        m_socket.peerAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.peerPort());
+
+    for (auto& dataPtr : dataList) {
+        dataPtr->m_extraProperties.insert(sslFromProp(), from);
+        dataPtr->m_extraProperties.insert(sslToProp(), to);
+    }
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
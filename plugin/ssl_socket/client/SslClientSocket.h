@@ -201,6 +201,8 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const DataInfosList& dataList) override;
+    virtual unsigned long long pendingBytesImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;
 
 private slots:
@@ -210,6 +212,8 @@ private slots:
     void sslErrorsOccurred(const QList<QSslError>& errs);
 
 private:
+    void setSentDataProps(const DataInfosList& dataList);
+
     static const PortType DefaultPort = SSL_CLIENT_DEFAULT_PORT;
     QString m_host;
     PortType m_port = DefaultPort;
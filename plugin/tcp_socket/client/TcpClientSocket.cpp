@@ -80,6 +80,9 @@ TcpClientSocket::TcpClientSocket()
     connect(
         &m_socket, &QTcpSocket::errorOccurred,
         this, &TcpClientSocket::socketErrorOccurred);
+    connect(
+        &m_socket, &QTcpSocket::bytesWritten,
+        this, &TcpClientSocket::reportBytesWritten);
 }
 
 TcpClientSocket::~TcpClientSocket() noexcept
@@ -134,16 +137,18 @@ void TcpClientSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         reinterpret_cast<const char*>(&dataPtr->m_data[0]),
         static_cast<qint64>(dataPtr->m_data.size()));
 
-    QString from =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
-    QString to =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
+    setSentDataProps(DataInfosList{dataPtr});
+}
 
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), to);
+void TcpClientSocket::sendDataListImpl(const DataInfosList& dataList)
+{
+    m_socket.write(concatData(dataList));
+    setSentDataProps(dataList);
+}
 
+unsigned long long TcpClientSocket::pendingBytesImpl() const
+{
+    return static_cast<unsigned long long>(m_socket.bytesToWrite());
 }
 
 void TcpClientSocket::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -229,6 +234,21 @@ void TcpClientSocket::socketErrorOccurred([[maybe_unused]] QAbstractSocket::Sock
     }
 }
 
+void TcpClientSocket::setSentDataProps(const DataInfosList& dataList)
+{
+    QString from =
+        m_socket.localAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.localPort());
+    QString to =
+        m_socket.peerAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.peerPort());
+
+    for (auto& dataPtr : dataList) {
+        dataPtr->m_extraProperties.insert(tcpFromProp(), from);
+        dataPtr->m_extraProperties.insert(tcpToProp(), to);
+    }
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
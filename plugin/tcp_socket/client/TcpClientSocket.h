@@ -71,6 +71,8 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const DataInfosList& dataList) override;
+    virtual unsigned long long pendingBytesImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;
 
 private slots:
@@ -81,6 +83,7 @@ private slots:
 private:
     QString getHostValue() const;
     PortType getPortValue() const;
+    void setSentDataProps(const DataInfosList& dataList);
 
     static const PortType DefaultPort = TCP_CLIENT_DEFAULT_PORT;
     QString m_host;
@@ -0,0 +1,414 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "TcpProxyForwarder.h"
+
+#include <QtCore/QtGlobal>
+#include <QtNetwork/QHostAddress>
+
+#include <algorithm>
+#include <cassert>
+
+namespace cc_tools_qt
+{
+
+namespace plugin
+{
+
+namespace
+{
+
+const QString& tcpFromProp()
+{
+    static const QString Str("tcp.from");
+    return Str;
+}
+
+const QString& tcpToProp()
+{
+    static const QString Str("tcp.to");
+    return Str;
+}
+
+}  // namespace
+
+TcpProxyForwarder::TcpProxyForwarder(const ToolsSocket& socket) :
+    m_socket(socket),
+    m_server(this)
+{
+    connect(
+        &m_server, &QTcpServer::newConnection,
+        this, &TcpProxyForwarder::newConnection);
+
+    connect(
+        &m_server, &QTcpServer::acceptError,
+        this, &TcpProxyForwarder::acceptErrorOccurred);
+}
+
+TcpProxyForwarder::~TcpProxyForwarder() noexcept
+{
+    closeAll();
+}
+
+bool TcpProxyForwarder::start(PortType port, const QString& remoteHost, PortType remotePort, QString& error)
+{
+    if (m_server.isListening()) {
+        [[maybe_unused]] static constexpr bool Already_listening = false;
+        assert(Already_listening);
+        static const QString AlreadyListeningError(
+            tr("Previous run of TCP/IP Server socket wasn't terminated properly."));
+        error = AlreadyListeningError;
+        return false;
+    }
+
+    m_remoteHost = remoteHost;
+    m_remotePort = remotePort;
+    if (!m_server.listen(QHostAddress::Any, port)) {
+        static const QString FailedToListenError(
+            tr("Failed to listen on specified TCP/IP port."));
+        error = FailedToListenError;
+        return false;
+    }
+
+    return true;
+}
+
+void TcpProxyForwarder::stop()
+{
+    m_server.close();
+}
+
+void TcpProxyForwarder::sendData(ToolsDataInfoPtr dataPtr)
+{
+    assert(dataPtr);
+    QVariantList toList;
+    for (auto& connectedPair : m_sockets) {
+        assert(connectedPair.m_client != nullptr);
+        assert(connectedPair.m_connection);
+        connectedPair.m_client->write(
+            reinterpret_cast<const char*>(&dataPtr->m_data[0]),
+            static_cast<qint64>(dataPtr->m_data.size()));
+        connectedPair.m_connection->write(
+            reinterpret_cast<const char*>(&dataPtr->m_data[0]),
+            static_cast<qint64>(dataPtr->m_data.size()));
+
+        toList.append(connectedPair.m_clientEndpoint);
+        toList.append(connectedPair.m_remoteEndpoint);
+    }
+    QString from =
+        m_server.serverAddress().toString() + ':' +
+                    QString("%1").arg(m_server.serverPort());
+
+    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
+    dataPtr->m_extraProperties.insert(tcpToProp(), toList);
+}
+
+void TcpProxyForwarder::closeAll()
+{
+    while (!m_sockets.empty()) {
+        removeConnection(m_sockets.begin());
+    }
+}
+
+void TcpProxyForwarder::newConnection()
+{
+    auto *newConnSocket = m_server.nextPendingConnection();
+    connect(
+        newConnSocket, &QTcpSocket::disconnected,
+        this, &TcpProxyForwarder::clientConnectionTerminated);
+    connect(
+        newConnSocket, &QTcpSocket::errorOccurred,
+        this, &TcpProxyForwarder::socketErrorOccurred);
+
+    ConnectionSocketPtr connectionSocket(new QTcpSocket);
+    connect(
+        connectionSocket.get(), &QTcpSocket::connected,
+        this, &TcpProxyForwarder::connectionSocketConnected);
+    connect(
+        connectionSocket.get(), &QTcpSocket::disconnected,
+        this, &TcpProxyForwarder::connectionSocketDisconnected);
+    connect(
+        connectionSocket.get(), &QTcpSocket::readyRead,
+        this, &TcpProxyForwarder::readFromConnectionSocket);
+
+    connect(
+        connectionSocket.get(), &QTcpSocket::errorOccurred,
+        this, &TcpProxyForwarder::socketErrorOccurred);
+
+    if (m_remoteHost.isEmpty()) {
+        m_remoteHost = QHostAddress(QHostAddress::LocalHost).toString();
+    }
+
+    connectionSocket->connectToHost(m_remoteHost, m_remotePort);
+    ConnectedPair pair;
+    pair.m_client = newConnSocket;
+    pair.m_connection = std::move(connectionSocket);
+    pair.m_clientEndpoint = endpointStr(*newConnSocket);
+    auto iter = m_sockets.insert(m_sockets.end(), std::move(pair));
+    m_pairs[iter->m_client] = iter;
+    m_pairs[iter->m_connection.get()] = iter;
+}
+
+void TcpProxyForwarder::clientConnectionTerminated()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    if (socket == nullptr) {
+        [[maybe_unused]] static constexpr bool Signal_from_unknown_object = false;
+        assert(Signal_from_unknown_object);
+        return;
+    }
+
+    auto iter = findByClient(socket);
+    if (iter == m_sockets.end()) {
+        return;
+    }
+
+    assert(iter->m_connection);
+    reportPairClosed(*iter);
+    socket->blockSignals(true);
+    iter->m_connection->blockSignals(true);
+    iter->m_connection->flush();
+    unindexPair(*iter);
+    m_sockets.erase(iter);
+    socket->deleteLater();
+}
+
+void TcpProxyForwarder::readFromClientSocket()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    assert(socket != nullptr);
+
+    auto iter = findByClient(socket);
+    assert (iter != m_sockets.end());
+    assert(iter->m_connection);
+    auto& connectionSocket = *(iter->m_connection);
+
+    performReadWrite(*socket, connectionSocket, iter->m_clientEndpoint, iter->m_remoteEndpoint);
+}
+
+void TcpProxyForwarder::socketErrorOccurred(QAbstractSocket::SocketError err)
+{
+    if (err == QAbstractSocket::RemoteHostClosedError) {
+        // Ignore remote client disconnection
+        return;
+    }
+
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    assert(socket != nullptr);
+
+    emit sigErrorReport(socket->errorString());
+}
+
+void TcpProxyForwarder::acceptErrorOccurred([[maybe_unused]] QAbstractSocket::SocketError err)
+{
+    emit sigErrorReport(m_server.errorString());
+    if (!m_server.isListening()) {
+        emit sigDisconnected();
+    }
+}
+
+void TcpProxyForwarder::connectionSocketConnected()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    if (socket == nullptr) {
+        [[maybe_unused]] static constexpr bool Signal_from_unknown_object = false;
+        assert(Signal_from_unknown_object);
+        return;
+    }
+
+    auto iter = findByConnection(socket);
+    assert(iter != m_sockets.end());
+    assert(iter->m_client != nullptr);
+    iter->m_remoteEndpoint = endpointStr(*socket);
+
+    connect(
+        iter->m_client, &QTcpSocket::readyRead,
+        this, &TcpProxyForwarder::readFromClientSocket);
+
+    if (0 < iter->m_client->bytesAvailable()) {
+        assert(iter->m_connection);
+        performReadWrite(*iter->m_client, *iter->m_connection, iter->m_clientEndpoint, iter->m_remoteEndpoint);
+    }
+}
+
+void TcpProxyForwarder::connectionSocketDisconnected()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    if (socket == nullptr) {
+        [[maybe_unused]] static constexpr bool Signal_from_unknown_object = false;
+        assert(Signal_from_unknown_object);
+        return;
+    }
+
+    auto iter = findByConnection(socket);
+    if (iter == m_sockets.end()) {
+        return;
+    }
+
+    assert(iter->m_client);
+    reportPairClosed(*iter);
+    iter->m_client->blockSignals(true);
+    iter->m_client->flush();
+    delete iter->m_client;
+
+    assert(iter->m_connection);
+    iter->m_connection->flush();
+    unindexPair(*iter);
+    iter->m_connection.release()->deleteLater();
+    m_sockets.erase(iter);
+}
+
+void TcpProxyForwarder::readFromConnectionSocket()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    assert(socket != nullptr);
+
+    auto iter = findByConnection(socket);
+    assert (iter != m_sockets.end());
+    assert(iter->m_client != nullptr);
+    auto& clientSocket = *(iter->m_client);
+    performReadWrite(*socket, clientSocket, iter->m_remoteEndpoint, iter->m_clientEndpoint);
+}
+
+TcpProxyForwarder::SocketsList::iterator TcpProxyForwarder::findByClient(QTcpSocket* socket)
+{
+    auto iter = m_pairs.find(socket);
+    if ((iter == m_pairs.end()) || (iter->second->m_client != socket)) {
+        return m_sockets.end();
+    }
+
+    return iter->second;
+}
+
+TcpProxyForwarder::SocketsList::iterator TcpProxyForwarder::findByConnection(QTcpSocket* socket)
+{
+    auto iter = m_pairs.find(socket);
+    if ((iter == m_pairs.end()) || (iter->second->m_connection.get() != socket)) {
+        return m_sockets.end();
+    }
+
+    return iter->second;
+}
+
+void TcpProxyForwarder::unindexPair(const ConnectedPair& pair)
+{
+    m_pairs.erase(pair.m_client);
+    m_pairs.erase(pair.m_connection.get());
+}
+
+void TcpProxyForwarder::removeConnection(SocketsList::iterator iter)
+{
+    assert(iter != m_sockets.end());
+    auto* clientSocket = iter->m_client;
+    assert(clientSocket);
+
+    reportPairClosed(*iter);
+    unindexPair(*iter);
+    ConnectionSocketPtr connectionSocket(std::move(iter->m_connection));
+    assert(connectionSocket);
+    assert(!iter->m_connection);
+
+    m_sockets.erase(iter);
+
+    clientSocket->blockSignals(true);
+    connectionSocket->blockSignals(true);
+
+    if (clientSocket->state() == QTcpSocket::ConnectedState) {
+        clientSocket->flush();
+        clientSocket->disconnectFromHost();
+    }
+    delete clientSocket;
+
+    if (connectionSocket->state() == QTcpSocket::ConnectedState) {
+        connectionSocket->flush();
+        connectionSocket->disconnectFromHost();
+    }
+}
+
+void TcpProxyForwarder::performReadWrite(
+    QTcpSocket& readFromSocket,
+    QTcpSocket& writeToSocket,
+    const QString& from,
+    const QString& to)
+{
+    auto dataSize = readFromSocket.bytesAvailable();
+    if (dataSize <= 0) {
+        return;
+    }
+
+    if (!m_socket.isDataReceivedReportEnabled()) {
+        // Forward only, nothing is going to consume the reported data
+        if (m_relayBuf.size() < static_cast<std::size_t>(dataSize)) {
+            m_relayBuf.resize(static_cast<std::size_t>(dataSize));
+        }
+
+        auto result = readFromSocket.read(m_relayBuf.data(), dataSize);
+        if (0 < result) {
+            writeToSocket.write(m_relayBuf.data(), result);
+        }
+        return;
+    }
+
+    auto dataPtr = makeDataInfo();
+    dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+
+    dataPtr->m_data.resize(static_cast<std::size_t>(dataSize));
+    auto result =
+        readFromSocket.read(reinterpret_cast<char*>(&dataPtr->m_data[0]), dataSize);
+    if (result != dataSize) {
+        dataPtr->m_data.resize(static_cast<std::size_t>(std::max<qint64>(result, 0)));
+    }
+
+    if (dataPtr->m_data.empty()) {
+        return;
+    }
+
+    writeToSocket.write(
+        reinterpret_cast<const char*>(&dataPtr->m_data[0]),
+        static_cast<qint64>(dataPtr->m_data.size()));
+
+    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
+    dataPtr->m_extraProperties.insert(tcpToProp(), to);
+
+    // All the connections to the remote end share the same "tcp.from"
+    // in one of the directions, use the socket identity to separate the streams.
+    dataPtr->m_source = sourceStr(readFromSocket);
+
+    emit sigDataReceived(std::move(dataPtr));
+}
+
+void TcpProxyForwarder::reportPairClosed(const ConnectedPair& pair)
+{
+    assert(pair.m_client != nullptr);
+    assert(pair.m_connection);
+    emit sigSourceClosed(sourceStr(*pair.m_client));
+    emit sigSourceClosed(sourceStr(*pair.m_connection));
+}
+
+QString TcpProxyForwarder::endpointStr(const QTcpSocket& socket)
+{
+    return socket.peerAddress().toString() + ':' + QString("%1").arg(socket.peerPort());
+}
+
+QString TcpProxyForwarder::sourceStr(const QTcpSocket& readFromSocket)
+{
+    return QString::number(reinterpret_cast<quintptr>(&readFromSocket), 16);
+}
+
+} // namespace plugin
+
+} // namespace cc_tools_qt
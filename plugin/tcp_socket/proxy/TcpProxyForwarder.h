@@ -0,0 +1,112 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "cc_tools_qt/ToolsDataInfo.h"
+#include "cc_tools_qt/ToolsSocket.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+namespace plugin
+{
+
+// Performs the actual forwarding of the TCP proxy in the dedicated I/O thread.
+// The monitored copy of the data is reported via queued signals, so the
+// forwarding is not delayed by the processing in the GUI thread.
+class TcpProxyForwarder : public QObject
+{
+    Q_OBJECT
+    using Base = QObject;
+
+public:
+    typedef unsigned short PortType;
+
+    explicit TcpProxyForwarder(const ToolsSocket& socket);
+    ~TcpProxyForwarder() noexcept;
+
+    // All the functions below are expected to be invoked in the I/O thread
+    bool start(PortType port, const QString& remoteHost, PortType remotePort, QString& error);
+    void stop();
+    void sendData(ToolsDataInfoPtr dataPtr);
+    void closeAll();
+
+signals:
+    void sigDataReceived(ToolsDataInfoPtr dataPtr);
+    void sigErrorReport(const QString& msg);
+    void sigDisconnected();
+    void sigSourceClosed(const QString& source);
+
+private slots:
+    void newConnection();
+    void clientConnectionTerminated();
+    void readFromClientSocket();
+    void socketErrorOccurred(QAbstractSocket::SocketError err);
+    void acceptErrorOccurred(QAbstractSocket::SocketError err);
+    void connectionSocketConnected();
+    void connectionSocketDisconnected();
+    void readFromConnectionSocket();
+
+private:
+    using ConnectionSocketPtr = std::unique_ptr<QTcpSocket>;
+
+    struct ConnectedPair
+    {
+        QTcpSocket* m_client = nullptr;
+        ConnectionSocketPtr m_connection;
+        QString m_clientEndpoint; ///< Cached "addr:port" of the client
+        QString m_remoteEndpoint; ///< Cached "addr:port" of the remote end, known when connected
+    };
+
+    using SocketsList = std::list<ConnectedPair>;
+
+    // Both client and connection sockets are mapped to their pair
+    using PairsMap = std::unordered_map<const QTcpSocket*, SocketsList::iterator>;
+
+    SocketsList::iterator findByClient(QTcpSocket* socket);
+    SocketsList::iterator findByConnection(QTcpSocket* socket);
+    void unindexPair(const ConnectedPair& pair);
+    void removeConnection(SocketsList::iterator iter);
+    void performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket, const QString& from, const QString& to);
+    static QString endpointStr(const QTcpSocket& socket);
+    void reportPairClosed(const ConnectedPair& pair);
+    static QString sourceStr(const QTcpSocket& readFromSocket);
+
+    const ToolsSocket& m_socket;
+    QString m_remoteHost;
+    PortType m_remotePort = 0U;
+
+    QTcpServer m_server;
+    SocketsList m_sockets;
+    PairsMap m_pairs;
+    std::vector<char> m_relayBuf;
+};
+
+} // namespace plugin
+
+} // namespace cc_tools_qt
@@ -17,8 +17,8 @@
 
 #include "TcpProxySocket.h"
 
+#include <QtCore/QMetaObject>
 #include <QtCore/QtGlobal>
-#include <QtNetwork/QHostAddress>
 
 #include <cassert>
 
@@ -31,18 +31,6 @@ namespace plugin
 namespace
 {
 
-const QString& tcpFromProp()
-{
-    static const QString Str("tcp.from");
-    return Str;
-}
-
-const QString& tcpToProp()
-{
-    static const QString Str("tcp.to");
-    return Str;
-}
-
 const QString& tcpHostProp()
 {
     static const QString Str("tcp.host");
@@ -81,35 +69,44 @@ const QString& networkLocalPortProp()
 
 }  // namespace
 
-TcpProxySocket::TcpProxySocket()
+TcpProxySocket::TcpProxySocket() :
+    m_forwarder(new TcpProxyForwarder(*this))
 {
-    QObject::connect(
-        &m_server, &QTcpServer::newConnection,
-        this, &TcpProxySocket::newConnection);
+    m_forwarder->moveToThread(&m_thread);
 
-    QObject::connect(
-        &m_server, &QTcpServer::acceptError,
-        this, &TcpProxySocket::socketErrorOccurred);
+    connect(
+        &m_thread, &QThread::finished,
+        m_forwarder, &QObject::deleteLater);
+    connect(
+        m_forwarder, &TcpProxyForwarder::sigDataReceived,
+        this, &TcpProxySocket::reportDataReceived,
+        Qt::QueuedConnection);
+    connect(
+        m_forwarder, &TcpProxyForwarder::sigErrorReport,
+        this, &TcpProxySocket::reportError,
+        Qt::QueuedConnection);
+    connect(
+        m_forwarder, &TcpProxyForwarder::sigDisconnected,
+        this, &TcpProxySocket::reportDisconnected,
+        Qt::QueuedConnection);
+    connect(
+        m_forwarder, &TcpProxyForwarder::sigSourceClosed,
+        this, &TcpProxySocket::reportSourceClosed,
+        Qt::QueuedConnection);
+
+    m_thread.start();
 }
 
 TcpProxySocket::~TcpProxySocket() noexcept
 {
-    while (!m_sockets.empty()) {
-        removeConnection(m_sockets.begin());
-    }
+    // The forwarder closes all the connections when deleted in its thread
+    QObject::disconnect(m_forwarder, nullptr, this, nullptr);
+    m_thread.quit();
+    m_thread.wait();
 }
 
 bool TcpProxySocket::socketConnectImpl()
 {
-    if (m_server.isListening()) {
-        [[maybe_unused]] static constexpr bool Already_listening = false;
-        assert(Already_listening);
-        static const QString AlreadyListeningError(
-            tr("Previous run of TCP/IP Server socket wasn't terminated properly."));
-        reportError(AlreadyListeningError);
-        return false;
-    }
-
     do {
         if (m_port != m_remotePort) {
             break;
@@ -127,49 +124,61 @@ bool TcpProxySocket::socketConnectImpl()
         return false;
     } while (false);
 
-    if (!m_server.listen(QHostAddress::Any, m_port)) {
-        static const QString FailedToListenError(
-            tr("Failed to listen on specified TCP/IP port."));
-        reportError(FailedToListenError);
-        return false;
+    bool result = false;
+    QString error;
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this, &result, &error]()
+        {
+            result = m_forwarder->start(m_port, m_remoteHost, m_remotePort, error);
+        },
+        Qt::BlockingQueuedConnection);
+
+    if (!result) {
+        reportError(error);
     }
 
-    return true;
+    return result;
 }
 
 void TcpProxySocket::socketDisconnectImpl()
 {
-    m_server.close();
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this]()
+        {
+            m_forwarder->stop();
+        },
+        Qt::BlockingQueuedConnection);
 }
 
 void TcpProxySocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
 {
     assert(dataPtr);
-    QVariantList toList;
-    for (auto& connectedPair : m_sockets) {
-        assert(connectedPair.first != nullptr);
-        assert(connectedPair.second);
-        connectedPair.first->write(
-            reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()));
-        connectedPair.second->write(
-            reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()));
-
-        toList.append(
-            connectedPair.first->peerAddress().toString() + ':' +
-                        QString("%1").arg(connectedPair.first->peerPort()));
-
-        toList.append(
-            connectedPair.second->peerAddress().toString() + ':' +
-                        QString("%1").arg(connectedPair.second->peerPort()));
-    }
-    QString from =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
 
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), toList);
+    // Blocking to have the "tcp.from" / "tcp.to" properties updated on return
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this, &dataPtr]()
+        {
+            m_forwarder->sendData(dataPtr);
+        },
+        Qt::BlockingQueuedConnection);
+}
+
+void TcpProxySocket::sendDataListImpl(const DataInfosList& dataList)
+{
+    // Single blocking invocation for the whole list instead of one per chunk
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this, &dataList]()
+        {
+            for (auto& dataPtr : dataList) {
+                assert(dataPtr);
+                m_forwarder->sendData(dataPtr);
+            }
+        },
+        Qt::BlockingQueuedConnection);
 }
 
 unsigned TcpProxySocket::connectionPropertiesImpl() const
@@ -224,237 +233,6 @@ void TcpProxySocket::applyInterPluginConfigImpl(const QVariantMap& props)
     }
 }
 
-void TcpProxySocket::newConnection()
-{
-    auto *newConnSocket = m_server.nextPendingConnection();
-    connect(
-        newConnSocket, &QTcpSocket::disconnected,
-        this, &TcpProxySocket::clientConnectionTerminated);
-    connect(
-        newConnSocket, &QTcpSocket::errorOccurred,
-        this, &TcpProxySocket::socketErrorOccurred);
-
-    ConnectionSocketPtr connectionSocket(new QTcpSocket);
-    connect(
-        connectionSocket.get(), &QTcpSocket::connected,
-        this, &TcpProxySocket::connectionSocketConnected);
-    connect(
-        connectionSocket.get(), &QTcpSocket::disconnected,
-        this, &TcpProxySocket::connectionSocketDisconnected);
-    connect(
-        connectionSocket.get(), &QTcpSocket::readyRead,
-        this, &TcpProxySocket::readFromConnectionSocket);
-
-    connect(
-        connectionSocket.get(), &QTcpSocket::errorOccurred,
-        this, &TcpProxySocket::socketErrorOccurred);
-
-    if (m_remoteHost.isEmpty()) {
-        m_remoteHost = QHostAddress(QHostAddress::LocalHost).toString();
-    }
-
-    connectionSocket->connectToHost(m_remoteHost, m_remotePort);
-    m_sockets.emplace_back(newConnSocket, std::move(connectionSocket));
-}
-
-void TcpProxySocket::clientConnectionTerminated()
-{
-    auto* socket = qobject_cast<QTcpSocket*>(sender());
-    if (socket == nullptr) {
-        [[maybe_unused]] static constexpr bool Signal_from_unknown_object = false;
-        assert(Signal_from_unknown_object);
-        return;
-    }
-
-    auto iter = findByClient(socket);
-    if (iter == m_sockets.end()) {
-        return;
-    }
-
-    assert(iter->second);
-    socket->blockSignals(true);
-    iter->second->blockSignals(true);
-    iter->second->flush();
-    m_sockets.erase(iter);
-    socket->deleteLater();
-}
-
-void TcpProxySocket::readFromClientSocket()
-{
-    auto* socket = qobject_cast<QTcpSocket*>(sender());
-    assert(socket != nullptr);
-
-    auto iter = findByClient(socket);
-    assert (iter != m_sockets.end());
-    assert(iter->second);
-    auto& connectionSocket = *(iter->second);
-
-    performReadWrite(*socket, connectionSocket);
-}
-
-void TcpProxySocket::socketErrorOccurred(QAbstractSocket::SocketError err)
-{
-    if (err == QAbstractSocket::RemoteHostClosedError) {
-        // Ignore remote client disconnection
-        return;
-    }
-
-    auto* socket = qobject_cast<QTcpSocket*>(sender());
-    assert(socket != nullptr);
-
-    reportError(socket->errorString());
-}
-
-void TcpProxySocket::acceptErrorOccurred([[maybe_unused]] QAbstractSocket::SocketError err)
-{
-    reportError(m_server.errorString());
-    if (!m_server.isListening()) {
-        reportDisconnected();
-    }
-}
-
-void TcpProxySocket::connectionSocketConnected()
-{
-    auto* socket = qobject_cast<QTcpSocket*>(sender());
-    if (socket == nullptr) {
-        [[maybe_unused]] static constexpr bool Signal_from_unknown_object = false;
-        assert(Signal_from_unknown_object);
-        return;
-    }
-
-    auto iter = findByConnection(socket);
-    assert(iter != m_sockets.end());
-    assert(iter->first != nullptr);
-
-    connect(
-        iter->first, &QTcpSocket::readyRead,
-        this, &TcpProxySocket::readFromClientSocket);
-
-    if (0 < iter->first->bytesAvailable()) {
-        assert(iter->second);
-        performReadWrite(*iter->first, *iter->second);
-    }
-}
-
-void TcpProxySocket::connectionSocketDisconnected()
-{
-    auto* socket = qobject_cast<QTcpSocket*>(sender());
-    if (socket == nullptr) {
-        [[maybe_unused]] static constexpr bool Signal_from_unknown_object = false;
-        assert(Signal_from_unknown_object);
-        return;
-    }
-
-    auto iter = findByConnection(socket);
-    if (iter == m_sockets.end()) {
-        return;
-    }
-
-    assert(iter->first);
-    iter->first->blockSignals(true);
-    iter->first->flush();
-    delete iter->first;
-
-    assert(iter->second);
-    iter->second->flush();
-    iter->second.release()->deleteLater();
-    m_sockets.erase(iter);
-}
-
-void TcpProxySocket::readFromConnectionSocket()
-{
-    auto* socket = qobject_cast<QTcpSocket*>(sender());
-    assert(socket != nullptr);
-
-    auto iter = findByConnection(socket);
-    assert (iter != m_sockets.end());
-    assert(iter->first != nullptr);
-    auto& clientSocket = *(iter->first);
-    performReadWrite(*socket, clientSocket);
-}
-
-TcpProxySocket::SocketsList::iterator TcpProxySocket::findByClient(QTcpSocket* socket)
-{
-    return std::find_if(
-        m_sockets.begin(), m_sockets.end(),
-        [socket](const ConnectedPair& elem) -> bool
-        {
-            return elem.first == socket;
-        });
-}
-
-TcpProxySocket::SocketsList::iterator TcpProxySocket::findByConnection(QTcpSocket* socket)
-{
-    return std::find_if(
-        m_sockets.begin(), m_sockets.end(),
-        [socket](const ConnectedPair& elem) -> bool
-        {
-            return elem.second.get() == socket;
-        });
-
-}
-
-void TcpProxySocket::removeConnection(SocketsList::iterator iter)
-{
-    assert(iter != m_sockets.end());
-    auto* clientSocket = iter->first;
-    assert(clientSocket);
-
-    ConnectionSocketPtr connectionSocket(std::move(iter->second));
-    assert(connectionSocket);
-    assert(!iter->second);
-
-    m_sockets.erase(iter);
-
-    clientSocket->blockSignals(true);
-    connectionSocket->blockSignals(true);
-
-    if (clientSocket->state() == QTcpSocket::ConnectedState) {
-        clientSocket->flush();
-        clientSocket->disconnectFromHost();
-    }
-    delete clientSocket;
-
-    if (connectionSocket->state() == QTcpSocket::ConnectedState) {
-        connectionSocket->flush();
-        connectionSocket->disconnectFromHost();
-    }
-}
-
-void TcpProxySocket::performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket)
-{
-    if (readFromSocket.bytesAvailable() == 0) {
-        return;
-    }
-
-    auto dataPtr = makeDataInfo();
-    dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
-
-    auto dataSize = readFromSocket.bytesAvailable();
-    dataPtr->m_data.resize(static_cast<std::size_t>(dataSize));
-    auto result =
-        readFromSocket.read(reinterpret_cast<char*>(&dataPtr->m_data[0]), dataSize);
-    if (result != dataSize) {
-        dataPtr->m_data.resize(static_cast<std::size_t>(result));
-    }
-
-    writeToSocket.write(
-        reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-        static_cast<qint64>(dataPtr->m_data.size()));
-
-    QString from =
-        readFromSocket.peerAddress().toString() + ':' +
-                    QString("%1").arg(readFromSocket.peerPort());
-    QString to =
-        writeToSocket.peerAddress().toString() + ':' +
-                    QString("%1").arg(writeToSocket.peerPort());
-
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), to);
-
-    reportDataReceived(std::move(dataPtr));
-}
-
 } // namespace plugin
 
 } // namespace cc_tools_qt
@@ -19,12 +19,9 @@
 
 #include "cc_tools_qt/ToolsSocket.h"
 
-#include <QtNetwork/QTcpServer>
-#include <QtNetwork/QTcpSocket>
+#include "TcpProxyForwarder.h"
 
-#include <list>
-#include <memory>
-#include <utility>
+#include <QtCore/QThread>
 
 #ifdef CC_TOOLS_QT_DEFAULT_NETWORK_PORT
 #define TCP_PROXY_DEFAULT_PORT CC_TOOLS_QT_DEFAULT_NETWORK_PORT
@@ -86,37 +83,18 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const DataInfosList& dataList) override;
     virtual unsigned connectionPropertiesImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;
 
-private slots:
-    void newConnection();
-    void clientConnectionTerminated();
-    void readFromClientSocket();
-    void socketErrorOccurred(QAbstractSocket::SocketError err);
-    void acceptErrorOccurred(QAbstractSocket::SocketError err);
-    void connectionSocketConnected();
-    void connectionSocketDisconnected();
-    void readFromConnectionSocket();
-
 private:
-    typedef QTcpSocket* ClientSocketPtr;
-    typedef std::unique_ptr<QTcpSocket> ConnectionSocketPtr;
-    typedef std::pair<ClientSocketPtr, ConnectionSocketPtr> ConnectedPair;
-    typedef std::list<ConnectedPair> SocketsList;
-
-    SocketsList::iterator findByClient(QTcpSocket* socket);
-    SocketsList::iterator findByConnection(QTcpSocket* socket);
-    void removeConnection(SocketsList::iterator iter);
-    void performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket);
-
     static const PortType DefaultPort = TCP_PROXY_DEFAULT_PORT;
     PortType m_port = DefaultPort;
     QString m_remoteHost;
     PortType m_remotePort = DefaultPort;
 
-    QTcpServer m_server;
-    SocketsList m_sockets;
+    QThread m_thread;
+    TcpProxyForwarder* m_forwarder = nullptr; // Lives in m_thread
 };
 
 } // namespace plugin
@@ -20,6 +20,7 @@
 #include <QtCore/QtGlobal>
 #include <QtNetwork/QHostAddress>
 
+#include <algorithm>
 #include <cassert>
 
 namespace cc_tools_qt
@@ -43,6 +44,12 @@ const QString& tcpToProp()
     return Str;
 }
 
+const QString& tcpClientProp()
+{
+    static const QString Str("tcp.client");
+    return Str;
+}
+
 const QString& tcpPortProp()
 {
     static const QString Str("tcp.port");
@@ -82,8 +89,8 @@ TcpServerSocket::TcpServerSocket()
 
 TcpServerSocket::~TcpServerSocket() noexcept
 {
-    for (auto* socket : m_sockets) {
-        socket->flush();
+    for (auto& conn : m_connections) {
+        conn.first->flush();
     }
 }
 
@@ -105,6 +112,7 @@ bool TcpServerSocket::socketConnectImpl()
         return false;
     }
 
+    m_serverEndpoint = endpointStr(m_server.serverAddress(), m_server.serverPort());
     return true;
 }
 
@@ -117,28 +125,99 @@ void TcpServerSocket::socketDisconnectImpl()
 void TcpServerSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
 {
     assert(dataPtr);
+    sendDataListImpl(DataInfosList{dataPtr});
+}
 
-    QVariantList toList;
+void TcpServerSocket::sendDataListImpl(const DataInfosList& dataList)
+{
+    bool targeted =
+        std::any_of(
+            dataList.begin(), dataList.end(),
+            [](const ToolsDataInfoPtr& dataPtr)
+            {
+                return dataPtr->m_extraProperties.contains(tcpClientProp());
+            });
+
+    if (!targeted) {
+        auto data = concatData(dataList);
+        for (auto& conn : m_connections) {
+            conn.first->write(data);
+        }
 
-    for (auto* socketTmp : m_sockets) {
-        auto* socket = qobject_cast<QTcpSocket*>(socketTmp);
-        assert(socket != nullptr);
-        socket->write(
-            reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()));
+        auto& toList = allEndpoints();
+        for (auto& dataPtr : dataList) {
+            dataPtr->m_extraProperties.insert(tcpFromProp(), m_serverEndpoint);
+            dataPtr->m_extraProperties.insert(tcpToProp(), toList);
+        }
+        return;
+    }
 
-        QString to =
-            socket->peerAddress().toString() + ':' +
-                        QString("%1").arg(socket->peerPort());
-        toList.append(to);
+    // Accumulated per connection to preserve the order of the chunks
+    assert(m_sendTargets.empty());
+    QStringList unknownEndpoints;
+    for (auto& dataPtr : dataList) {
+        dataPtr->m_extraProperties.insert(tcpFromProp(), m_serverEndpoint);
+        auto clientVar = dataPtr->m_extraProperties.value(tcpClientProp());
+        if (!clientVar.isValid()) {
+            for (auto& conn : m_connections) {
+                appendSendData(conn.first, conn.second, *dataPtr);
+            }
+
+            dataPtr->m_extraProperties.insert(tcpToProp(), allEndpoints());
+            continue;
+        }
+
+        // Either single "addr:port" string or a list of them
+        QVariantList toList;
+        auto endpoints = clientVar.toStringList();
+        for (auto& endpoint : endpoints) {
+            auto* socket = m_endpoints.value(endpoint, nullptr);
+            if (socket == nullptr) {
+                if (!unknownEndpoints.contains(endpoint)) {
+                    unknownEndpoints.append(endpoint);
+                }
+                continue;
+            }
+
+            if (toList.contains(endpoint)) {
+                continue;
+            }
+
+            auto iter = m_connections.find(socket);
+            assert(iter != m_connections.end());
+            appendSendData(socket, iter->second, *dataPtr);
+            toList.append(endpoint);
+        }
+
+        if (!toList.isEmpty()) {
+            dataPtr->m_extraProperties.insert(tcpToProp(), toList);
+        }
+    }
+
+    for (auto* socket : m_sendTargets) {
+        auto iter = m_connections.find(socket);
+        assert(iter != m_connections.end());
+        socket->write(iter->second.m_sendBuf);
+        iter->second.m_sendBuf.clear();
     }
+    m_sendTargets.clear();
 
-    QString from =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
+    if (!unknownEndpoints.isEmpty()) {
+        reportError(tr("Unknown TCP/IP client: %1").arg(unknownEndpoints.join(", ")));
+    }
+}
+
+unsigned long long TcpServerSocket::pendingBytesImpl() const
+{
+    // The same data is written to all the clients, the slowest one
+    // determines the flow.
+    unsigned long long result = 0U;
+    for (auto& conn : m_connections) {
+        assert(conn.first != nullptr);
+        result = std::max(result, static_cast<unsigned long long>(conn.first->bytesToWrite()));
+    }
 
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), toList);
+    return result;
 }
 
 unsigned TcpServerSocket::connectionPropertiesImpl() const
@@ -173,7 +252,11 @@ void TcpServerSocket::applyInterPluginConfigImpl(const QVariantMap& props)
 void TcpServerSocket::newConnection()
 {
     auto *newConnSocket = m_server.nextPendingConnection();
-    m_sockets.push_back(newConnSocket);
+    auto endpoint = endpointStr(newConnSocket->peerAddress(), newConnSocket->peerPort());
+    m_connections[newConnSocket].m_endpoint = endpoint;
+    m_endpoints.insert(endpoint, newConnSocket);
+    m_allEndpointsValid = false;
+
     connect(
         newConnSocket, &QTcpSocket::disconnected,
         newConnSocket, &TcpServerSocket::deleteLater);
@@ -186,19 +269,29 @@ void TcpServerSocket::newConnection()
     connect(
         newConnSocket, &QTcpSocket::errorOccurred,
         this, &TcpServerSocket::socketErrorOccurred);
+    connect(
+        newConnSocket, &QTcpSocket::bytesWritten,
+        this, &TcpServerSocket::reportBytesWritten);
 }
 
 void TcpServerSocket::connectionTerminated()
 {
-    auto* socket = sender();
-    auto iter = std::find(m_sockets.begin(), m_sockets.end(), socket);
-    if (iter == m_sockets.end()) {
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    auto iter = m_connections.find(socket);
+    if (iter == m_connections.end()) {
         [[maybe_unused]] static constexpr bool Must_have_found_socket = false;
         assert(Must_have_found_socket);
         return;
     }
 
-    m_sockets.erase(iter);
+    auto endpoint = std::move(iter->second.m_endpoint);
+    m_endpoints.remove(endpoint);
+    m_connections.erase(iter);
+    m_allEndpointsValid = false;
+    reportSourceClosed(endpoint);
+
+    // The terminated connection might have been the slowest one
+    reportBytesWritten();
 }
 
 void TcpServerSocket::readFromSocket()
@@ -217,15 +310,11 @@ void TcpServerSocket::readFromSocket()
         dataPtr->m_data.resize(static_cast<std::size_t>(result));
     }
 
-    QString from =
-        socket->peerAddress().toString() + ':' +
-                    QString("%1").arg(socket->peerPort());
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-
-    QString to =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
-    dataPtr->m_extraProperties.insert(tcpToProp(), to);
+    auto iter = m_connections.find(socket);
+    assert(iter != m_connections.end());
+    dataPtr->m_extraProperties.insert(tcpFromProp(), iter->second.m_endpoint);
+    dataPtr->m_extraProperties.insert(tcpToProp(), m_serverEndpoint);
+    dataPtr->m_source = iter->second.m_endpoint;
 
     reportDataReceived(std::move(dataPtr));
 }
@@ -251,6 +340,38 @@ void TcpServerSocket::acceptErrorOccurred([[maybe_unused]] QAbstractSocket::Sock
     }
 }
 
+void TcpServerSocket::appendSendData(QTcpSocket* socket, ConnectionInfo& info, const ToolsDataInfo& data)
+{
+    if (info.m_sendBuf.isEmpty()) {
+        m_sendTargets.push_back(socket);
+    }
+
+    info.m_sendBuf.append(
+        reinterpret_cast<const char*>(data.m_data.data()),
+        static_cast<int>(data.m_data.size()));
+}
+
+const QVariantList& TcpServerSocket::allEndpoints()
+{
+    if (m_allEndpointsValid) {
+        return m_allEndpoints;
+    }
+
+    m_allEndpoints.clear();
+    m_allEndpoints.reserve(static_cast<int>(m_connections.size()));
+    for (auto& conn : m_connections) {
+        m_allEndpoints.append(conn.second.m_endpoint);
+    }
+
+    m_allEndpointsValid = true;
+    return m_allEndpoints;
+}
+
+QString TcpServerSocket::endpointStr(const QHostAddress& addr, quint16 port)
+{
+    return addr.toString() + ':' + QString("%1").arg(port);
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
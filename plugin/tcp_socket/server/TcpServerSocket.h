@@ -19,10 +19,14 @@
 
 #include "cc_tools_qt/ToolsSocket.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QVariantList>
+#include <QtNetwork/QHostAddress>
 #include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
 
-#include <list>
+#include <unordered_map>
+#include <vector>
 
 #ifdef CC_TOOLS_QT_DEFAULT_NETWORK_PORT
 #define TCP_SERVER_DEFAULT_PORT CC_TOOLS_QT_DEFAULT_NETWORK_PORT
@@ -64,6 +68,8 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const DataInfosList& dataList) override;
+    virtual unsigned long long pendingBytesImpl() const override;
     virtual unsigned connectionPropertiesImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;
 
@@ -75,9 +81,28 @@ private slots:
     void acceptErrorOccurred(QAbstractSocket::SocketError err);
 
 private:
+    struct ConnectionInfo
+    {
+        QString m_endpoint; ///< Cached "addr:port" of the peer
+        QByteArray m_sendBuf; ///< Accumulated data of the targeted send
+    };
+
+    using ConnectionsMap = std::unordered_map<QTcpSocket*, ConnectionInfo>;
+    using EndpointsMap = QHash<QString, QTcpSocket*>;
+    using SocketsList = std::vector<QTcpSocket*>;
+
+    void appendSendData(QTcpSocket* socket, ConnectionInfo& info, const ToolsDataInfo& data);
+    const QVariantList& allEndpoints();
+    static QString endpointStr(const QHostAddress& addr, quint16 port);
+
     static const PortType DefaultPort = TCP_SERVER_DEFAULT_PORT;
     PortType m_port = DefaultPort;
-    std::list<QTcpSocket*> m_sockets;
+    ConnectionsMap m_connections;
+    EndpointsMap m_endpoints;
+    SocketsList m_sendTargets;
+    QVariantList m_allEndpoints;
+    bool m_allEndpointsValid = false;
+    QString m_serverEndpoint;
     QTcpServer m_server;
 };
 
@@ -0,0 +1,271 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "UdpDatagramReader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace cc_tools_qt
+{
+
+namespace plugin
+{
+
+namespace
+{
+
+const std::size_t MaxDatagramSize = 64U * 1024U;
+
+} // namespace
+
+struct UdpDatagramReader::NativeState
+{
+#ifdef __linux__
+    static const std::size_t ControlSize = CMSG_SPACE(sizeof(std::uint32_t));
+
+    explicit NativeState(std::size_t batchSize) :
+        m_msgs(batchSize),
+        m_iovecs(batchSize),
+        m_addrs(batchSize),
+        m_control(batchSize * ControlSize),
+        m_data(batchSize * MaxDatagramSize)
+    {
+    }
+
+    std::vector<mmsghdr> m_msgs;
+    std::vector<iovec> m_iovecs;
+    std::vector<sockaddr_storage> m_addrs;
+    std::vector<char> m_control;
+    std::vector<char> m_data;
+#endif // #ifdef __linux__
+};
+
+UdpDatagramReader::UdpDatagramReader(QObject* parentObj) :
+    Base(parentObj)
+{
+}
+
+UdpDatagramReader::~UdpDatagramReader() noexcept
+{
+    close();
+}
+
+void UdpDatagramReader::open(QUdpSocket& socket)
+{
+    close();
+    m_droppedCount = 0U;
+    m_socket = &socket;
+
+    if (0 < m_recvBufSize) {
+        socket.setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, m_recvBufSize);
+    }
+
+    if (openNative(socket)) {
+        // Nothing is read via the QUdpSocket, its own read notifier gets
+        // disabled by Qt after the first unconsumed activation.
+        return;
+    }
+
+    connect(
+        &socket, &QUdpSocket::readyRead,
+        this, &UdpDatagramReader::sigReadyRead,
+        Qt::UniqueConnection);
+}
+
+void UdpDatagramReader::shareBuffers(UdpDatagramReader& other)
+{
+    m_buffers = other.buffers();
+}
+
+void UdpDatagramReader::close()
+{
+    if (m_socket != nullptr) {
+        disconnect(
+            m_socket, &QUdpSocket::readyRead,
+            this, &UdpDatagramReader::sigReadyRead);
+        m_socket = nullptr;
+    }
+
+    m_notifier.reset();
+    m_native.reset();
+
+#ifdef __linux__
+    if (0 <= m_fd) {
+        ::close(m_fd);
+    }
+#endif // #ifdef __linux__
+
+    m_fd = -1;
+    m_socketFd = -1;
+}
+
+bool UdpDatagramReader::openNative([[maybe_unused]] QUdpSocket& socket)
+{
+#ifdef __linux__
+    auto fd = socket.socketDescriptor();
+    if (fd < 0) {
+        return false;
+    }
+
+    // The notifier of the QUdpSocket stays on the original descriptor,
+    // the duplicate one allows having own notifier without a clash.
+    m_fd = ::dup(static_cast<int>(fd));
+    if (m_fd < 0) {
+        return false;
+    }
+
+    m_socketFd = fd;
+
+    int enabled = 1;
+    ::setsockopt(m_fd, SOL_SOCKET, SO_RXQ_OVFL, &enabled, sizeof(enabled));
+
+    m_native = buffers();
+    m_notifier = std::make_unique<QSocketNotifier>(m_fd, QSocketNotifier::Read);
+    connect(
+        m_notifier.get(), &QSocketNotifier::activated,
+        this, &UdpDatagramReader::sigReadyRead);
+    return true;
+#else // #ifdef __linux__
+    return false;
+#endif // #ifdef __linux__
+}
+
+std::size_t UdpDatagramReader::readPending(QUdpSocket& socket, const DatagramHandler& handler)
+{
+    if (m_native && (socket.socketDescriptor() != m_socketFd)) {
+        // The socket has been recreated (e.g. on connect)
+        open(socket);
+    }
+
+    if (m_native) {
+        return readPendingNative(handler);
+    }
+
+    return readPendingGeneric(socket, handler);
+}
+
+std::size_t UdpDatagramReader::readPendingNative([[maybe_unused]] const DatagramHandler& handler)
+{
+    std::size_t total = 0U;
+
+#ifdef __linux__
+    assert(m_native);
+    assert(0 <= m_fd);
+    auto& state = *m_native;
+    auto batchSize = state.m_msgs.size();
+    while (true) {
+        for (auto idx = 0U; idx < batchSize; ++idx) {
+            auto& vec = state.m_iovecs[idx];
+            vec.iov_base = &state.m_data[idx * MaxDatagramSize];
+            vec.iov_len = MaxDatagramSize;
+
+            auto& hdr = state.m_msgs[idx].msg_hdr;
+            hdr.msg_name = &state.m_addrs[idx];
+            hdr.msg_namelen = sizeof(sockaddr_storage);
+            hdr.msg_iov = &vec;
+            hdr.msg_iovlen = 1U;
+            hdr.msg_control = &state.m_control[idx * NativeState::ControlSize];
+            hdr.msg_controllen = NativeState::ControlSize;
+            hdr.msg_flags = 0;
+            state.m_msgs[idx].msg_len = 0U;
+        }
+
+        auto count = ::recvmmsg(m_fd, state.m_msgs.data(), static_cast<unsigned>(batchSize), MSG_DONTWAIT, nullptr);
+        if (count <= 0) {
+            break;
+        }
+
+        for (auto idx = 0U; idx < static_cast<unsigned>(count); ++idx) {
+            auto& hdr = state.m_msgs[idx].msg_hdr;
+            for (auto* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+                if ((cmsg->cmsg_level != SOL_SOCKET) || (cmsg->cmsg_type != SO_RXQ_OVFL)) {
+                    continue;
+                }
+
+                // Total number of datagrams dropped by the socket
+                std::uint32_t dropped = 0U;
+                std::memcpy(&dropped, CMSG_DATA(cmsg), sizeof(dropped));
+                m_droppedCount = dropped;
+            }
+
+            auto* addr = reinterpret_cast<const sockaddr*>(&state.m_addrs[idx]);
+            quint16 port = 0U;
+            if (addr->sa_family == AF_INET) {
+                port = ntohs(reinterpret_cast<const sockaddr_in*>(addr)->sin_port);
+            }
+            else if (addr->sa_family == AF_INET6) {
+                port = ntohs(reinterpret_cast<const sockaddr_in6*>(addr)->sin6_port);
+            }
+
+            auto size = std::min(static_cast<std::size_t>(state.m_msgs[idx].msg_len), MaxDatagramSize);
+            handler(&state.m_data[idx * MaxDatagramSize], size, QHostAddress(addr), port);
+        }
+
+        total += static_cast<std::size_t>(count);
+        if (static_cast<std::size_t>(count) < batchSize) {
+            break;
+        }
+    }
+#endif // #ifdef __linux__
+
+    return total;
+}
+
+UdpDatagramReader::NativeStatePtr UdpDatagramReader::buffers()
+{
+    if (!m_buffers) {
+        m_buffers = std::make_shared<NativeState>(std::max(m_batchSize, 1U));
+    }
+
+    return m_buffers;
+}
+
+std::size_t UdpDatagramReader::readPendingGeneric(QUdpSocket& socket, const DatagramHandler& handler)
+{
+    std::size_t total = 0U;
+    while (socket.hasPendingDatagrams()) {
+        auto size = static_cast<std::size_t>(std::max<qint64>(socket.pendingDatagramSize(), 0));
+        if (m_buf.size() < std::max<std::size_t>(size, 1U)) {
+            m_buf.resize(std::max<std::size_t>(size, 1U));
+        }
+
+        QHostAddress addr;
+        quint16 port = 0U;
+        auto result = socket.readDatagram(m_buf.data(), static_cast<qint64>(size), &addr, &port);
+        if (result < 0) {
+            break;
+        }
+
+        handler(m_buf.data(), static_cast<std::size_t>(result), addr, port);
+        ++total;
+    }
+
+    return total;
+}
+
+} // namespace plugin
+
+} // namespace cc_tools_qt
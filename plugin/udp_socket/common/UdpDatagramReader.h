@@ -0,0 +1,122 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QtCore/QObject>
+#include <QtCore/QSocketNotifier>
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+namespace plugin
+{
+
+// Reads the pending datagrams of the bound UDP socket in batches.
+// On Linux uses recvmmsg() on the duplicate of the socket descriptor
+// and reports the datagrams dropped due to the receive buffer overflow,
+// on other platforms falls back to QUdpSocket::readDatagram().
+// The readers used in the same thread can share the batch buffers.
+// The sigReadyRead() signal is the only readiness notification to use,
+// in the fallback mode it is forwarded from QUdpSocket::readyRead().
+class UdpDatagramReader : public QObject
+{
+    Q_OBJECT
+    using Base = QObject;
+
+public:
+    using DatagramHandler = std::function<void (const char* data, std::size_t size, const QHostAddress& addr, quint16 port)>;
+
+    static const unsigned DefaultBatchSize = 32U;
+    static const int DefaultRecvBufSize = 4 * 1024 * 1024;
+
+    explicit UdpDatagramReader(QObject* parentObj = nullptr);
+    ~UdpDatagramReader() noexcept;
+
+    void setBatchSize(unsigned value)
+    {
+        m_batchSize = value;
+    }
+
+    unsigned getBatchSize() const
+    {
+        return m_batchSize;
+    }
+
+    // 0 keeps the system default
+    void setRecvBufSize(int value)
+    {
+        m_recvBufSize = value;
+    }
+
+    int getRecvBufSize() const
+    {
+        return m_recvBufSize;
+    }
+
+    // Use the batch buffers of the other reader instead of allocating own ones,
+    // expected to be invoked before open(). Both readers must be used
+    // in the same thread.
+    void shareBuffers(UdpDatagramReader& other);
+
+    // Expected to be invoked when the socket descriptor is available (bound or connected)
+    void open(QUdpSocket& socket);
+    void close();
+
+    // Invokes the handler for every pending datagram, returns number of read datagrams
+    std::size_t readPending(QUdpSocket& socket, const DatagramHandler& handler);
+
+    unsigned long long droppedCount() const
+    {
+        return m_droppedCount;
+    }
+
+signals:
+    void sigReadyRead();
+
+private:
+    bool openNative(QUdpSocket& socket);
+    std::size_t readPendingNative(const DatagramHandler& handler);
+    std::size_t readPendingGeneric(QUdpSocket& socket, const DatagramHandler& handler);
+
+    struct NativeState;
+    using NativeStatePtr = std::shared_ptr<NativeState>;
+
+    NativeStatePtr buffers();
+
+    unsigned m_batchSize = DefaultBatchSize;
+    int m_recvBufSize = DefaultRecvBufSize;
+    QUdpSocket* m_socket = nullptr; ///< Opened socket
+    qintptr m_socketFd = -1;
+    int m_fd = -1;
+    std::unique_ptr<QSocketNotifier> m_notifier;
+    NativeStatePtr m_buffers; ///< Possibly shared with other readers
+    NativeStatePtr m_native; ///< Used while opened in native mode
+    std::vector<char> m_buf;
+    unsigned long long m_droppedCount = 0U;
+};
+
+} // namespace plugin
+
+} // namespace cc_tools_qt
@@ -21,6 +21,7 @@
 #include <QtNetwork/QHostAddress>
 
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 
 namespace cc_tools_qt
@@ -138,7 +139,7 @@ UdpGenericSocket::UdpGenericSocket()
         &m_socket, &QUdpSocket::disconnected,
         this, &UdpGenericSocket::socketDisconnected);
     connect(
-        &m_socket, &QUdpSocket::readyRead,
+        &m_reader, &UdpDatagramReader::sigReadyRead,
         this, &UdpGenericSocket::readFromSocket);
     connect(
         &m_socket, &QUdpSocket::errorOccurred,
@@ -148,6 +149,7 @@ UdpGenericSocket::UdpGenericSocket()
 UdpGenericSocket::~UdpGenericSocket() noexcept
 {
     m_socket.blockSignals(true);
+    m_reader.close();
 }
 
 bool UdpGenericSocket::socketConnectImpl()
@@ -207,11 +209,16 @@ bool UdpGenericSocket::socketConnectImpl()
         m_defaultTtl = DefaultTtl;
     } while (false);
 
+    if (m_socket.isOpen()) {
+        m_reader.open(m_socket);
+    }
+
     return true;
 }
 
 void UdpGenericSocket::socketDisconnectImpl()
 {
+    m_reader.close();
     m_socket.blockSignals(true);
     m_socket.close();
     m_running = false;
@@ -335,6 +342,11 @@ void UdpGenericSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
     dataPtr->m_extraProperties.insert(udpToProp(), to);
 }
 
+unsigned long long UdpGenericSocket::droppedCountImpl() const
+{
+    return m_reader.droppedCount();
+}
+
 void UdpGenericSocket::applyInterPluginConfigImpl(const QVariantMap& props)
 {
     bool updated = false;
@@ -402,37 +414,45 @@ void UdpGenericSocket::socketDisconnected()
 
 void UdpGenericSocket::readFromSocket()
 {
-    while (m_socket.hasPendingDatagrams()) {
-        QHostAddress senderAddress;
-        quint16 senderPort;
-
-        auto dataPtr = makeDataInfo();
-        dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
-        dataPtr->m_data.resize(static_cast<std::size_t>(m_socket.pendingDatagramSize()));
-        m_socket.readDatagram(
-            reinterpret_cast<char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()),
-            &senderAddress,
-            &senderPort);
-
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
+    DataInfosList dataList;
+    bool reportEnabled = isDataReceivedReportEnabled();
+    QString to;
+    if (reportEnabled) {
+        to =
             m_socket.localAddress().toString() + ':' +
                         QString("%1").arg(m_socket.localPort());
+    }
 
-        dataPtr->m_extraProperties.insert(udpFromProp(), from);
-        dataPtr->m_extraProperties.insert(udpToProp(), to);
-        reportDataReceived(std::move(dataPtr));
+    m_reader.readPending(
+        m_socket,
+        [this, reportEnabled, &to, &dataList](const char* data, std::size_t size, const QHostAddress& senderAddress, quint16 senderPort)
+        {
+            if (reportEnabled) {
+                auto dataPtr = makeDataInfo();
+                dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+                dataPtr->m_data.assign(
+                    reinterpret_cast<const std::uint8_t*>(data),
+                    reinterpret_cast<const std::uint8_t*>(data) + size);
+
+                QString from =
+                    senderAddress.toString() + ':' +
+                                QString("%1").arg(senderPort);
+
+                dataPtr->m_extraProperties.insert(udpFromProp(), from);
+                dataPtr->m_extraProperties.insert(udpToProp(), to);
+                dataList.append(std::move(dataPtr));
+            }
 
-        if (m_socket.state() != QUdpSocket::ConnectedState) {
-            m_socket.connectToHost(senderAddress, senderPort);
-            m_socket.waitForConnected();
-            assert(m_socket.isOpen());
-            assert(m_socket.state() == QUdpSocket::ConnectedState);
-        }
-    }
+            if (m_socket.state() != QUdpSocket::ConnectedState) {
+                m_socket.connectToHost(senderAddress, senderPort);
+                m_socket.waitForConnected();
+                assert(m_socket.isOpen());
+                assert(m_socket.state() == QUdpSocket::ConnectedState);
+            }
+        });
+
+    // The whole batch is handed over at once
+    reportDataListReceived(std::move(dataList));
 }
 
 void UdpGenericSocket::socketErrorOccurred([[maybe_unused]] QAbstractSocket::SocketError err)
@@ -19,6 +19,8 @@
 
 #include "cc_tools_qt/ToolsSocket.h"
 
+#include "UdpDatagramReader.h"
+
 #include <QtNetwork/QUdpSocket>
 
 #ifdef CC_TOOLS_QT_DEFAULT_NETWORK_PORT
@@ -84,6 +86,26 @@ public:
         return m_broadcastMask;
     }
 
+    void setRecvBatchSize(unsigned value)
+    {
+        m_reader.setBatchSize(value);
+    }
+
+    unsigned getRecvBatchSize() const
+    {
+        return m_reader.getBatchSize();
+    }
+
+    void setRecvBufSize(int value)
+    {
+        m_reader.setRecvBufSize(value);
+    }
+
+    int getRecvBufSize() const
+    {
+        return m_reader.getRecvBufSize();
+    }
+
 signals:
     void sigConfigChanged();
 
@@ -91,6 +113,7 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual unsigned long long droppedCountImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;
 
 private slots:
@@ -108,6 +131,7 @@ private:
     PortType m_localPort = 0;
     QString m_broadcastMask = "255.255.255.255";
     QUdpSocket m_socket;
+    UdpDatagramReader m_reader;
     int m_defaultTtl = 0;
     bool m_running = false;
 };
@@ -36,6 +36,8 @@ const QString HostSubKey("host");
 const QString PortSubKey("port");
 const QString LocalPortSubKey("local_port");
 const QString BroadcastMaskSubKey("broadcast_prop");
+const QString RecvBatchSizeSubKey("recv_batch_size");
+const QString RecvBufSizeSubKey("recv_buf_size");
 
 }  // namespace
 
@@ -55,6 +57,8 @@ void UdpGenericSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(PortSubKey, m_socket->getPort());
     subConfig.insert(LocalPortSubKey, m_socket->getLocalPort());
     subConfig.insert(BroadcastMaskSubKey, m_socket->getBroadcastMask());
+    subConfig.insert(RecvBatchSizeSubKey, m_socket->getRecvBatchSize());
+    subConfig.insert(RecvBufSizeSubKey, m_socket->getRecvBufSize());
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -93,6 +97,16 @@ void UdpGenericSocketPlugin::reconfigureImpl(const QVariantMap& config)
         auto broadcastMask = broadcastMaskVar.value<QString>();
         m_socket->setBroadcastMask(broadcastMask);
     }
+
+    auto recvBatchSizeVar = subConfig.value(RecvBatchSizeSubKey);
+    if (recvBatchSizeVar.isValid() && recvBatchSizeVar.canConvert<unsigned>()) {
+        m_socket->setRecvBatchSize(recvBatchSizeVar.value<unsigned>());
+    }
+
+    auto recvBufSizeVar = subConfig.value(RecvBufSizeSubKey);
+    if (recvBufSizeVar.isValid() && recvBufSizeVar.canConvert<int>()) {
+        m_socket->setRecvBufSize(recvBufSizeVar.value<int>());
+    }
 }
 
 void UdpGenericSocketPlugin::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -0,0 +1,444 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "UdpProxyForwarder.h"
+
+#include <QtCore/QtGlobal>
+#include <QtCore/QVariantList>
+#include <QtNetwork/QHostInfo>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+
+namespace cc_tools_qt
+{
+
+namespace plugin
+{
+
+namespace
+{
+
+const QString& udpFromProp()
+{
+    static const QString Str("udp.from");
+    return Str;
+}
+
+const QString& udpToProp()
+{
+    static const QString Str("udp.to");
+    return Str;
+}
+
+const unsigned IdleCheckDivider = 4U;
+const unsigned MinIdleCheckPeriodMs = 100U;
+
+}  // namespace
+
+UdpProxyForwarder::UdpProxyForwarder(const ToolsSocket& socket) :
+    m_socket(socket),
+    m_listenReader(this),
+    m_idleTimer(this)
+{
+    connect(
+        &m_listenReader, &UdpDatagramReader::sigReadyRead,
+        this, &UdpProxyForwarder::readFromListenSocket);
+    connect(
+        &m_idleTimer, &QTimer::timeout,
+        this, &UdpProxyForwarder::removeIdleSessions);
+}
+
+UdpProxyForwarder::~UdpProxyForwarder() noexcept
+{
+    stop();
+}
+
+bool UdpProxyForwarder::start(const Config& config, QString& error)
+{
+    m_config = config;
+    m_listenReader.setBatchSize(m_config.m_recvBatchSize);
+    m_listenReader.setRecvBufSize(m_config.m_recvBufSize);
+
+    if (!resolveRemote(error)) {
+        return false;
+    }
+
+    if (!createListenSocket(error)) {
+        m_listenReader.close();
+        m_listenSocket.reset();
+        return false;
+    }
+
+    m_sessionsLimitReported = false;
+    m_droppedCount = 0U;
+    if (m_config.m_sessionTimeoutMs != 0U) {
+        m_idleTimer.start(static_cast<int>(std::max(m_config.m_sessionTimeoutMs / IdleCheckDivider, MinIdleCheckPeriodMs)));
+    }
+
+    m_running = true;
+    return true;
+}
+
+void UdpProxyForwarder::stop()
+{
+    m_idleTimer.stop();
+    removeAllSessions();
+    m_listenReader.close();
+
+    if (m_listenSocket) {
+        m_listenSocket->blockSignals(true);
+    }
+
+    m_listenSocket.reset();
+    m_running = false;
+}
+
+void UdpProxyForwarder::sendData(ToolsDataInfoPtr dataPtr)
+{
+    if (!m_running) {
+        return;
+    }
+
+    assert(dataPtr);
+    assert(m_listenSocket);
+    dataPtr->m_extraProperties.insert(udpFromProp(), endpointStr(m_listenSocket->localAddress(), m_listenSocket->localPort()));
+
+    // Sent to all the clients
+    QVariantList toList;
+    for (auto& session : m_sessions) {
+        auto count =
+            m_listenSocket->writeDatagram(
+                reinterpret_cast<const char*>(dataPtr->m_data.data()),
+                static_cast<qint64>(dataPtr->m_data.size()),
+                session.m_clientAddr,
+                session.m_clientPort);
+
+        if (count < 0) {
+            continue;
+        }
+
+        toList.append(session.m_clientEndpoint);
+    }
+
+    dataPtr->m_extraProperties.insert(udpToProp(), toList);
+}
+
+void UdpProxyForwarder::readFromListenSocket()
+{
+    if (!m_listenSocket) {
+        return;
+    }
+
+    ToolsSocket::DataInfosList dataList;
+    auto reportEnabled = m_socket.isDataReceivedReportEnabled();
+    auto now = std::chrono::steady_clock::now();
+    readPending(
+        m_listenReader,
+        *m_listenSocket,
+        [this, reportEnabled, now, &dataList](const char* data, std::size_t size, const QHostAddress& senderAddress, quint16 senderPort)
+        {
+            if (!m_running) {
+                return;
+            }
+
+            auto iter = findOrCreateSession(senderAddress, senderPort);
+            if (iter == m_sessions.end()) {
+                return;
+            }
+
+            iter->m_lastActivity = now;
+            assert(iter->m_upstream);
+            iter->m_upstream->writeDatagram(data, static_cast<qint64>(size), m_remoteAddr, m_config.m_port);
+
+            if (!reportEnabled) {
+                // Forward only, nothing is going to consume the reported data
+                return;
+            }
+
+            auto dataPtr = makeDataInfo();
+            dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+            dataPtr->m_data.assign(
+                reinterpret_cast<const std::uint8_t*>(data),
+                reinterpret_cast<const std::uint8_t*>(data) + size);
+            dataPtr->m_extraProperties.insert(udpFromProp(), iter->m_clientEndpoint);
+            dataPtr->m_extraProperties.insert(udpToProp(), m_remoteEndpoint);
+            dataPtr->m_source = iter->m_clientEndpoint;
+            dataList.append(std::move(dataPtr));
+        });
+
+    if (!dataList.isEmpty()) {
+        emit sigDataListReceived(std::move(dataList));
+    }
+}
+
+void UdpProxyForwarder::listenSocketErrorOccurred([[maybe_unused]] QAbstractSocket::SocketError err)
+{
+    assert(m_listenSocket);
+    emit sigErrorReport(QString("Listen socket error: " + m_listenSocket->errorString()));
+}
+
+void UdpProxyForwarder::readFromUpstreamSocket()
+{
+    auto iter = findBySender(sender());
+    if (iter == m_sessions.end()) {
+        return;
+    }
+
+    auto& session = *iter;
+    assert(session.m_upstream);
+    assert(session.m_reader);
+
+    ToolsSocket::DataInfosList dataList;
+    auto reportEnabled = m_socket.isDataReceivedReportEnabled();
+    auto now = std::chrono::steady_clock::now();
+    readPending(
+        *session.m_reader,
+        *session.m_upstream,
+        [this, reportEnabled, now, &session, &dataList](const char* data, std::size_t size, const QHostAddress& senderAddress, quint16 senderPort)
+        {
+            if ((!m_running) || (!m_listenSocket)) {
+                return;
+            }
+
+            session.m_lastActivity = now;
+            m_listenSocket->writeDatagram(data, static_cast<qint64>(size), session.m_clientAddr, session.m_clientPort);
+
+            if (!reportEnabled) {
+                // Forward only, nothing is going to consume the reported data
+                return;
+            }
+
+            auto dataPtr = makeDataInfo();
+            dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+            dataPtr->m_data.assign(
+                reinterpret_cast<const std::uint8_t*>(data),
+                reinterpret_cast<const std::uint8_t*>(data) + size);
+            dataPtr->m_extraProperties.insert(udpFromProp(), endpointStr(senderAddress, senderPort));
+            dataPtr->m_extraProperties.insert(udpToProp(), session.m_clientEndpoint);
+            dataPtr->m_source = session.m_upstreamEndpoint;
+            dataList.append(std::move(dataPtr));
+        });
+
+    if (!dataList.isEmpty()) {
+        emit sigDataListReceived(std::move(dataList));
+    }
+}
+
+void UdpProxyForwarder::upstreamSocketErrorOccurred([[maybe_unused]] QAbstractSocket::SocketError err)
+{
+    auto iter = findBySender(sender());
+    if (iter == m_sessions.end()) {
+        return;
+    }
+
+    assert(iter->m_upstream);
+    emit sigErrorReport(
+        QString("Remote connection socket error (client %1): %2")
+            .arg(iter->m_clientEndpoint)
+            .arg(iter->m_upstream->errorString()));
+}
+
+void UdpProxyForwarder::removeIdleSessions()
+{
+    auto now = std::chrono::steady_clock::now();
+    auto timeout = std::chrono::milliseconds(m_config.m_sessionTimeoutMs);
+    auto iter = m_sessions.begin();
+    while (iter != m_sessions.end()) {
+        auto nextIter = std::next(iter);
+        if (timeout <= (now - iter->m_lastActivity)) {
+            removeSession(iter);
+        }
+
+        iter = nextIter;
+    }
+}
+
+bool UdpProxyForwarder::createListenSocket(QString& error)
+{
+    m_listenSocket = std::make_unique<QUdpSocket>();
+
+    connect(
+        m_listenSocket.get(), &QUdpSocket::errorOccurred,
+        this, &UdpProxyForwarder::listenSocketErrorOccurred);
+
+    if (!m_listenSocket->bind(QHostAddress::AnyIPv4, m_config.m_localPort)) {
+        error = "Failed to bind UDP socket to port " + QString("%1").arg(m_config.m_localPort);
+        return false;
+    }
+
+    if (!m_listenSocket->open(QUdpSocket::ReadWrite)) {
+        error = "Failed to open local UDP listening on port " + QString("%1").arg(m_config.m_localPort);
+        return false;
+    }
+
+    m_listenReader.open(*m_listenSocket);
+    return true;
+}
+
+bool UdpProxyForwarder::resolveRemote(QString& error)
+{
+    // Resolved once on start, the forwarding itself never blocks
+    m_remoteAddr = QHostAddress(m_config.m_host);
+    if (m_remoteAddr.isNull()) {
+        auto info = QHostInfo::fromName(m_config.m_host);
+        auto addresses = info.addresses();
+        auto iter =
+            std::find_if(
+                addresses.begin(), addresses.end(),
+                [](const QHostAddress& addr)
+                {
+                    return addr.protocol() == QAbstractSocket::IPv4Protocol;
+                });
+
+        if (iter != addresses.end()) {
+            m_remoteAddr = *iter;
+        }
+        else if (!addresses.isEmpty()) {
+            m_remoteAddr = addresses.front();
+        }
+    }
+
+    if (m_remoteAddr.isNull()) {
+        error = "Failed to resolve remote host " + m_config.m_host;
+        return false;
+    }
+
+    m_remoteEndpoint = endpointStr(m_remoteAddr, m_config.m_port);
+    return true;
+}
+
+UdpProxyForwarder::SessionsList::iterator UdpProxyForwarder::findOrCreateSession(const QHostAddress& addr, quint16 port)
+{
+    auto clientKey = ClientKey(addr, port);
+    auto mapIter = m_sessionsByClient.find(clientKey);
+    if (mapIter != m_sessionsByClient.end()) {
+        return mapIter.value();
+    }
+
+    if ((m_config.m_maxSessions != 0U) && (m_config.m_maxSessions <= m_sessions.size())) {
+        ++m_droppedCount;
+        if (!m_sessionsLimitReported) {
+            m_sessionsLimitReported = true;
+            emit sigErrorReport(
+                QString("Maximum number of sessions (%1) reached, dropping data from new clients")
+                    .arg(m_config.m_maxSessions));
+        }
+        return m_sessions.end();
+    }
+
+    m_sessionsLimitReported = false;
+    auto clientEndpoint = endpointStr(addr, port);
+    auto upstream = std::make_unique<QUdpSocket>();
+    auto bindAddr = QHostAddress(QHostAddress::AnyIPv4);
+    if (m_remoteAddr.protocol() == QAbstractSocket::IPv6Protocol) {
+        bindAddr = QHostAddress(QHostAddress::AnyIPv6);
+    }
+
+    if (!upstream->bind(bindAddr, 0U)) {
+        emit sigErrorReport("Failed to create remote connection socket for client " + clientEndpoint + ": " + upstream->errorString());
+        return m_sessions.end();
+    }
+
+    // All the readers are used in this thread, one at a time
+    auto reader = std::make_unique<UdpDatagramReader>();
+    reader->setBatchSize(m_config.m_recvBatchSize);
+    reader->setRecvBufSize(m_config.m_sessionRecvBufSize);
+    reader->shareBuffers(m_listenReader);
+
+    connect(
+        upstream.get(), &QUdpSocket::errorOccurred,
+        this, &UdpProxyForwarder::upstreamSocketErrorOccurred);
+    connect(
+        reader.get(), &UdpDatagramReader::sigReadyRead,
+        this, &UdpProxyForwarder::readFromUpstreamSocket);
+
+    reader->open(*upstream);
+
+    Session session;
+    session.m_clientAddr = addr;
+    session.m_clientPort = port;
+    session.m_clientEndpoint = std::move(clientEndpoint);
+    session.m_upstreamEndpoint = endpointStr(upstream->localAddress(), upstream->localPort());
+    session.m_upstream = std::move(upstream);
+    session.m_reader = std::move(reader);
+    session.m_lastActivity = std::chrono::steady_clock::now();
+
+    auto iter = m_sessions.insert(m_sessions.end(), std::move(session));
+    m_sessionsByClient.insert(clientKey, iter);
+    m_sessionsByObject[iter->m_upstream.get()] = iter;
+    m_sessionsByObject[iter->m_reader.get()] = iter;
+    return iter;
+}
+
+UdpProxyForwarder::SessionsList::iterator UdpProxyForwarder::findBySender(QObject* obj)
+{
+    auto iter = m_sessionsByObject.find(obj);
+    if (iter == m_sessionsByObject.end()) {
+        return m_sessions.end();
+    }
+
+    return iter->second;
+}
+
+void UdpProxyForwarder::removeSession(SessionsList::iterator iter)
+{
+    assert(iter != m_sessions.end());
+    assert(iter->m_upstream);
+    assert(iter->m_reader);
+
+    emit sigSourceClosed(iter->m_clientEndpoint);
+    emit sigSourceClosed(iter->m_upstreamEndpoint);
+
+    m_sessionsByClient.remove(ClientKey(iter->m_clientAddr, iter->m_clientPort));
+    m_sessionsByObject.erase(iter->m_upstream.get());
+    m_sessionsByObject.erase(iter->m_reader.get());
+
+    iter->m_reader->close();
+    iter->m_upstream->blockSignals(true);
+    m_sessions.erase(iter);
+}
+
+void UdpProxyForwarder::removeAllSessions()
+{
+    while (!m_sessions.empty()) {
+        removeSession(m_sessions.begin());
+    }
+}
+
+void UdpProxyForwarder::readPending(UdpDatagramReader& reader, QUdpSocket& socket, const UdpDatagramReader::DatagramHandler& handler)
+{
+    // Only the change of the read reader is accumulated,
+    // the total is never recalculated from all the sessions.
+    auto droppedBefore = reader.droppedCount();
+    reader.readPending(socket, handler);
+    auto droppedAfter = reader.droppedCount();
+    if (droppedBefore < droppedAfter) {
+        m_droppedCount += droppedAfter - droppedBefore;
+    }
+}
+
+QString UdpProxyForwarder::endpointStr(const QHostAddress& addr, quint16 port)
+{
+    return addr.toString() + ':' + QString("%1").arg(port);
+}
+
+} // namespace plugin
+
+} // namespace cc_tools_qt
@@ -0,0 +1,151 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "cc_tools_qt/ToolsDataInfo.h"
+#include "cc_tools_qt/ToolsSocket.h"
+
+#include "UdpDatagramReader.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QPair>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace cc_tools_qt
+{
+
+namespace plugin
+{
+
+// Performs the actual forwarding of the UDP proxy in the dedicated I/O thread.
+// Every client is served by its own session with a dedicated upstream socket,
+// the sessions are released after the configured period of inactivity.
+// The sessions share the batch buffers of the listen socket reader and
+// use smaller kernel receive buffers, the number of sessions is limited.
+// The monitored copy of the data is reported via queued signals, so the
+// forwarding is not delayed by the processing in the GUI thread.
+class UdpProxyForwarder : public QObject
+{
+    Q_OBJECT
+    using Base = QObject;
+
+public:
+    typedef unsigned short PortType;
+
+    static const int DefaultSessionRecvBufSize = 256 * 1024;
+    static const unsigned DefaultMaxSessions = 1024U;
+
+    struct Config
+    {
+        QString m_host;
+        PortType m_port = 0U;
+        PortType m_localPort = 0U;
+        unsigned m_recvBatchSize = UdpDatagramReader::DefaultBatchSize;
+        int m_recvBufSize = UdpDatagramReader::DefaultRecvBufSize;
+        unsigned m_sessionTimeoutMs = 0U; ///< 0 means never expire
+        int m_sessionRecvBufSize = DefaultSessionRecvBufSize; ///< 0 keeps the system default
+        unsigned m_maxSessions = DefaultMaxSessions; ///< Datagrams of the new clients are dropped when reached
+    };
+
+    explicit UdpProxyForwarder(const ToolsSocket& socket);
+    ~UdpProxyForwarder() noexcept;
+
+    // All the functions below are expected to be invoked in the I/O thread
+    bool start(const Config& config, QString& error);
+    void stop();
+    void sendData(ToolsDataInfoPtr dataPtr);
+
+    // Thread safe
+    unsigned long long droppedCount() const
+    {
+        return m_droppedCount;
+    }
+
+signals:
+    void sigDataListReceived(cc_tools_qt::ToolsSocket::DataInfosList dataList);
+    void sigErrorReport(const QString& msg);
+    void sigSourceClosed(const QString& source);
+
+private slots:
+    void readFromListenSocket();
+    void listenSocketErrorOccurred(QAbstractSocket::SocketError err);
+    void readFromUpstreamSocket();
+    void upstreamSocketErrorOccurred(QAbstractSocket::SocketError err);
+    void removeIdleSessions();
+
+private:
+    using SocketPtr = std::unique_ptr<QUdpSocket>;
+    using ReaderPtr = std::unique_ptr<UdpDatagramReader>;
+    using Timestamp = std::chrono::steady_clock::time_point;
+
+    struct Session
+    {
+        QHostAddress m_clientAddr;
+        quint16 m_clientPort = 0U;
+        QString m_clientEndpoint; ///< Cached "addr:port" of the client
+        QString m_upstreamEndpoint; ///< Cached "addr:port" of the local end of the upstream socket
+        SocketPtr m_upstream;
+        ReaderPtr m_reader;
+        Timestamp m_lastActivity;
+    };
+
+    using SessionsList = std::list<Session>;
+
+    // Client address and port
+    using ClientKey = QPair<QHostAddress, quint16>;
+
+    // Both upstream socket and its reader are mapped to the session
+    using SessionObjectsMap = std::unordered_map<const QObject*, SessionsList::iterator>;
+
+    bool createListenSocket(QString& error);
+    bool resolveRemote(QString& error);
+    SessionsList::iterator findOrCreateSession(const QHostAddress& addr, quint16 port);
+    SessionsList::iterator findBySender(QObject* obj);
+    void removeSession(SessionsList::iterator iter);
+    void removeAllSessions();
+    void readPending(UdpDatagramReader& reader, QUdpSocket& socket, const UdpDatagramReader::DatagramHandler& handler);
+    static QString endpointStr(const QHostAddress& addr, quint16 port);
+
+    const ToolsSocket& m_socket;
+    Config m_config;
+    QHostAddress m_remoteAddr;
+    QString m_remoteEndpoint;
+    SocketPtr m_listenSocket;
+    UdpDatagramReader m_listenReader;
+    SessionsList m_sessions;
+    QHash<ClientKey, SessionsList::iterator> m_sessionsByClient;
+    SessionObjectsMap m_sessionsByObject;
+    QTimer m_idleTimer;
+    bool m_sessionsLimitReported = false;
+    std::atomic<unsigned long long> m_droppedCount{0U};
+    bool m_running = false;
+};
+
+} // namespace plugin
+
+} // namespace cc_tools_qt
@@ -17,11 +17,10 @@
 
 #include "UdpProxySocket.h"
 
+#include <QtCore/QMetaObject>
 #include <QtCore/QtGlobal>
-#include <QtNetwork/QHostAddress>
 
 #include <cassert>
-#include <iostream>
 
 namespace cc_tools_qt
 {
@@ -32,18 +31,6 @@ namespace plugin
 namespace
 {
 
-const QString& udpFromProp()
-{
-    static const QString Str("udp.from");
-    return Str;
-}
-
-const QString& udpToProp()
-{
-    static const QString Str("udp.to");
-    return Str;
-}
-
 const QString& udpHostProp()
 {
     static const QString Str("udp.host");
@@ -82,15 +69,36 @@ const QString& networkLocalPortProp()
 
 }  // namespace
 
-UdpProxySocket::UdpProxySocket()
+UdpProxySocket::UdpProxySocket() :
+    m_forwarder(new UdpProxyForwarder(*this))
 {
+    m_forwarder->moveToThread(&m_thread);
+
+    connect(
+        &m_thread, &QThread::finished,
+        m_forwarder, &QObject::deleteLater);
+    connect(
+        m_forwarder, &UdpProxyForwarder::sigDataListReceived,
+        this, &UdpProxySocket::reportDataListReceived,
+        Qt::QueuedConnection);
+    connect(
+        m_forwarder, &UdpProxyForwarder::sigErrorReport,
+        this, &UdpProxySocket::reportError,
+        Qt::QueuedConnection);
+    connect(
+        m_forwarder, &UdpProxyForwarder::sigSourceClosed,
+        this, &UdpProxySocket::reportSourceClosed,
+        Qt::QueuedConnection);
+
+    m_thread.start();
 }
 
 UdpProxySocket::~UdpProxySocket() noexcept
 {
-    if (m_listenSocket) {
-        m_listenSocket->blockSignals(true);
-    }
+    // The forwarder closes its sockets when deleted in its thread
+    QObject::disconnect(m_forwarder, nullptr, this, nullptr);
+    m_thread.quit();
+    m_thread.wait();
 }
 
 bool UdpProxySocket::socketConnectImpl()
@@ -116,68 +124,74 @@ bool UdpProxySocket::socketConnectImpl()
         return false;
     }
 
-    if (!createListenSocket()) {
-        m_listenSocket.reset();
-        return false;
+    UdpProxyForwarder::Config config;
+    config.m_host = m_host;
+    config.m_port = m_port;
+    config.m_localPort = m_localPort;
+    config.m_recvBatchSize = m_recvBatchSize;
+    config.m_recvBufSize = m_recvBufSize;
+    config.m_sessionTimeoutMs = m_sessionTimeout * 1000U;
+
+    bool result = false;
+    QString error;
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this, &config, &result, &error]()
+        {
+            result = m_forwarder->start(config, error);
+        },
+        Qt::BlockingQueuedConnection);
+
+    if (!result) {
+        reportError(error);
     }
 
-    m_running = true;
-    return true;
+    return result;
 }
 
 void UdpProxySocket::socketDisconnectImpl()
 {
-    if (m_listenSocket) {
-        m_listenSocket->blockSignals(true);
-    }
-
-    if (m_remoteSocket) {
-        m_remoteSocket->blockSignals(true);
-    }
-
-    m_listenSocket.reset();
-    m_remoteSocket.reset();
-    m_running = false;
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this]()
+        {
+            m_forwarder->stop();
+        },
+        Qt::BlockingQueuedConnection);
 }
 
 void UdpProxySocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
 {
-    if (!m_running) {
-        return;
-    }
-
     assert(dataPtr);
-    assert(m_listenSocket);
-    QString from =
-        m_listenSocket->localAddress().toString() + ':' +
-                    QString("%1").arg(m_listenSocket->localPort());
-    dataPtr->m_extraProperties.insert(udpFromProp(), from);
-
-    assert(m_listenSocket);
-    if (!m_listenSocket->isOpen()) {
-        return;
-    }
 
-    std::size_t writtenCount = 0;
-    while (writtenCount < dataPtr->m_data.size()) {
-        auto remSize = static_cast<qint64>(dataPtr->m_data.size() - writtenCount);
-        auto count =
-            m_listenSocket->write(
-                reinterpret_cast<const char*>(&dataPtr->m_data[writtenCount]),
-                remSize);
-
-        if (count < 0) {
-            return;
-        }
-
-        writtenCount += static_cast<std::size_t>(count);
-    }
-
-    QString to =
-        m_listenSocket->peerAddress().toString() + ':' +
-                    QString("%1").arg(m_listenSocket->peerPort());
+    // Blocking to have the "udp.from" / "udp.to" properties updated on return
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this, &dataPtr]()
+        {
+            m_forwarder->sendData(dataPtr);
+        },
+        Qt::BlockingQueuedConnection);
+}
+
+void UdpProxySocket::sendDataListImpl(const DataInfosList& dataList)
+{
+    // Single blocking invocation for the whole list instead of one per chunk
+    QMetaObject::invokeMethod(
+        m_forwarder,
+        [this, &dataList]()
+        {
+            for (auto& dataPtr : dataList) {
+                assert(dataPtr);
+                m_forwarder->sendData(dataPtr);
+            }
+        },
+        Qt::BlockingQueuedConnection);
+}
 
-    dataPtr->m_extraProperties.insert(udpToProp(), to);
+unsigned long long UdpProxySocket::droppedCountImpl() const
+{
+    return m_forwarder->droppedCount();
 }
 
 void UdpProxySocket::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -227,186 +241,6 @@ void UdpProxySocket::applyInterPluginConfigImpl(const QVariantMap& props)
     }
 }
 
-void UdpProxySocket::listenSocketDisconnected()
-{
-    reportDisconnected();
-    if (m_remoteSocket) {
-        m_remoteSocket->blockSignals(true);
-    }
-
-    m_remoteSocket.reset();
-    m_listenSocket->blockSignals(true);
-    m_listenSocket.release()->deleteLater();
-}
-
-void UdpProxySocket::readFromListenSocket()
-{
-    createRemoteSocketIfNeeded();
-
-    assert(m_listenSocket);
-    while (m_listenSocket->hasPendingDatagrams()) {
-        QHostAddress senderAddress;
-        quint16 senderPort;
-
-        auto dataPtr = makeDataInfo();
-        dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
-        dataPtr->m_data.resize(static_cast<std::size_t>(m_listenSocket->pendingDatagramSize()));
-        m_listenSocket->readDatagram(
-            reinterpret_cast<char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()),
-            &senderAddress,
-            &senderPort);
-
-        if (!m_running) {
-            continue;
-        }
-
-        if (m_listenSocket->state() != QUdpSocket::ConnectedState) {
-            m_listenSocket->connectToHost(senderAddress, senderPort);
-            if (!m_listenSocket->waitForConnected(100)) {
-                std::cerr << "WARNING: cannot connect to the initiating UDP socket." << std::endl;
-            }
-        }
-
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
-            m_listenSocket->localAddress().toString() + ':' +
-                        QString("%1").arg(m_listenSocket->localPort());
-
-        if (m_remoteSocket) {
-            m_remoteSocket->write(reinterpret_cast<const char*>(dataPtr->m_data.data()), static_cast<qint64>(dataPtr->m_data.size()));
-
-            to = m_remoteSocket->peerAddress().toString() + ':' +
-                        QString("%1").arg(m_remoteSocket->peerPort());
-        }
-
-        dataPtr->m_extraProperties.insert(udpFromProp(), from);
-        dataPtr->m_extraProperties.insert(udpToProp(), to);
-        reportDataReceived(std::move(dataPtr));
-    }
-}
-
-void UdpProxySocket::listenSocketErrorOccurred([[maybe_unused]] QAbstractSocket::SocketError err)
-{
-    assert(m_listenSocket);
-    reportError(QString("Listen socket error: " + m_listenSocket->errorString()));
-}
-
-void UdpProxySocket::remoteSocketDisconnected()
-{
-    assert(m_remoteSocket);
-    reportDisconnected();
-
-    if (m_listenSocket) {
-        m_remoteSocket->blockSignals(true);
-    }
-
-    m_listenSocket.reset();
-    m_remoteSocket->blockSignals(true);
-    m_remoteSocket.release()->deleteLater();
-}
-
-void UdpProxySocket::readFromRemoteSocket()
-{
-    assert(m_remoteSocket);
-    while (m_remoteSocket->hasPendingDatagrams()) {
-        QHostAddress senderAddress;
-        quint16 senderPort;
-
-        auto dataPtr = makeDataInfo();
-        dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
-        dataPtr->m_data.resize(static_cast<std::size_t>(m_remoteSocket->pendingDatagramSize()));
-        m_remoteSocket->readDatagram(
-            reinterpret_cast<char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()),
-            &senderAddress,
-            &senderPort);
-
-        if (!m_running) {
-            continue;
-        }
-
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
-            m_remoteSocket->localAddress().toString() + ':' +
-                        QString("%1").arg(m_remoteSocket->localPort());
-
-        if (m_listenSocket) {
-            m_listenSocket->write(reinterpret_cast<const char*>(dataPtr->m_data.data()), static_cast<qint64>(dataPtr->m_data.size()));
-
-            to = m_listenSocket->peerAddress().toString() + ':' +
-                        QString("%1").arg(m_listenSocket->peerPort());
-        }
-
-        dataPtr->m_extraProperties.insert(udpFromProp(), from);
-        dataPtr->m_extraProperties.insert(udpToProp(), to);
-        reportDataReceived(std::move(dataPtr));
-    }
-}
-
-void UdpProxySocket::remoteSocketErrorOccurred([[maybe_unused]] QAbstractSocket::SocketError err)
-{
-    assert(m_remoteSocket);
-    reportError(QString("Remote connection socket error: " + m_remoteSocket->errorString()));
-}
-
-bool UdpProxySocket::createListenSocket()
-{
-    m_listenSocket = std::make_unique<QUdpSocket>();
-
-    connect(
-        m_listenSocket.get(), &QUdpSocket::disconnected,
-        this, &UdpProxySocket::listenSocketDisconnected);
-    connect(
-        m_listenSocket.get(), &QUdpSocket::readyRead,
-        this, &UdpProxySocket::readFromListenSocket);
-    connect(
-        m_listenSocket.get(), &QUdpSocket::errorOccurred,
-        this, &UdpProxySocket::listenSocketErrorOccurred);
-
-    if (!m_listenSocket->bind(QHostAddress::AnyIPv4, m_localPort)) {
-        reportError("Failed to bind UDP socket to port " + QString("%1").arg(m_localPort));
-        return false;
-    }
-
-    if (!m_listenSocket->open(QUdpSocket::ReadWrite)) {
-        reportError("Failed to open local UDP listening on port " + QString("%1").arg(m_localPort));
-        return false;
-    }
-
-    return true;
-}
-
-void UdpProxySocket::createRemoteSocketIfNeeded()
-{
-    if (m_remoteSocket) {
-        return;
-    }
-
-    m_remoteSocket = std::make_unique<QUdpSocket>();
-
-    connect(
-        m_remoteSocket.get(), &QUdpSocket::disconnected,
-        this, &UdpProxySocket::remoteSocketDisconnected);
-    connect(
-        m_remoteSocket.get(), &QUdpSocket::readyRead,
-        this, &UdpProxySocket::readFromRemoteSocket);
-    connect(
-        m_remoteSocket.get(), &QUdpSocket::errorOccurred,
-        this, &UdpProxySocket::remoteSocketErrorOccurred);
-
-    m_remoteSocket->connectToHost(m_host, m_port);
-    if (!m_remoteSocket->waitForConnected(1000)) {
-        reportError("Failed to connect to remote " + QString("%1:%2").arg(m_host).arg(m_port));
-        m_remoteSocket.reset();
-        return;
-    }
-}
-
 } // namespace plugin
 
 } // namespace cc_tools_qt
@@ -19,9 +19,11 @@
 
 #include "cc_tools_qt/ToolsSocket.h"
 
-#include <QtNetwork/QUdpSocket>
+#include "UdpProxyForwarder.h"
 
-#include <memory>
+#include <QtCore/QThread>
+
+#include <algorithm>
 
 #ifdef CC_TOOLS_QT_DEFAULT_NETWORK_PORT
 #define UDP_PROXY_DEFAULT_PORT CC_TOOLS_QT_DEFAULT_NETWORK_PORT
@@ -43,6 +45,8 @@ class UdpProxySocket : public cc_tools_qt::ToolsSocket
 public:
     typedef unsigned short PortType;
 
+    static constexpr unsigned MaxSessionTimeout = 7U * 24U * 60U * 60U; ///< In seconds
+
     UdpProxySocket();
     ~UdpProxySocket() noexcept;
 
@@ -76,6 +80,36 @@ public:
         return m_localPort;
     }
 
+    void setRecvBatchSize(unsigned value)
+    {
+        m_recvBatchSize = value;
+    }
+
+    unsigned getRecvBatchSize() const
+    {
+        return m_recvBatchSize;
+    }
+
+    void setRecvBufSize(int value)
+    {
+        m_recvBufSize = value;
+    }
+
+    int getRecvBufSize() const
+    {
+        return m_recvBufSize;
+    }
+
+    void setSessionTimeout(unsigned value)
+    {
+        m_sessionTimeout = std::min(value, MaxSessionTimeout);
+    }
+
+    unsigned getSessionTimeout() const
+    {
+        return m_sessionTimeout;
+    }
+
 signals:
     void sigConfigChanged();
 
@@ -83,31 +117,22 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const DataInfosList& dataList) override;
+    virtual unsigned long long droppedCountImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;
 
-private slots:
-    void listenSocketDisconnected();
-    void readFromListenSocket();
-    void listenSocketErrorOccurred(QAbstractSocket::SocketError err);
-    void remoteSocketDisconnected();
-    void readFromRemoteSocket();
-    void remoteSocketErrorOccurred(QAbstractSocket::SocketError err);
-
 private:
-    using SocketPtr = std::unique_ptr<QUdpSocket>;
-
-    void readData(QUdpSocket& socket);
-    bool createListenSocket();
-    void createRemoteSocketIfNeeded();
-
     static const PortType DefaultPort = UDP_PROXY_DEFAULT_PORT;
+    static const unsigned DefaultSessionTimeout = 60U;
 
     QString m_host;
     PortType m_port = DefaultPort;
     PortType m_localPort = DefaultPort + 1;
-    SocketPtr m_listenSocket;
-    SocketPtr m_remoteSocket;
-    bool m_running = false;
+    unsigned m_recvBatchSize = UdpDatagramReader::DefaultBatchSize;
+    int m_recvBufSize = UdpDatagramReader::DefaultRecvBufSize;
+    unsigned m_sessionTimeout = DefaultSessionTimeout; ///< Seconds of client inactivity, 0 means never expire
+    QThread m_thread;
+    UdpProxyForwarder* m_forwarder = nullptr; // Lives in m_thread
 };
 
 } // namespace plugin
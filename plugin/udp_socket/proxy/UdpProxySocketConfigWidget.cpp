@@ -41,6 +41,10 @@ UdpProxySocketConfigWidget::UdpProxySocketConfigWidget(
         0,
         static_cast<int>(std::numeric_limits<PortType>::max()));
 
+    m_ui.m_sessionTimeoutSpinBox->setRange(
+        0,
+        static_cast<int>(UdpProxySocket::MaxSessionTimeout));
+
     refresh();
 
     connect(
@@ -58,6 +62,10 @@ UdpProxySocketConfigWidget::UdpProxySocketConfigWidget(
     connect(
         m_ui.m_localPortSpinBox, qOverload<int>(&QSpinBox::valueChanged),
         this, &UdpProxySocketConfigWidget::localPortValueChanged);
+
+    connect(
+        m_ui.m_sessionTimeoutSpinBox, qOverload<int>(&QSpinBox::valueChanged),
+        this, &UdpProxySocketConfigWidget::sessionTimeoutValueChanged);
 }
 
 UdpProxySocketConfigWidget::~UdpProxySocketConfigWidget() noexcept = default;
@@ -76,6 +84,9 @@ void UdpProxySocketConfigWidget::refresh()
 
     m_ui.m_localPortSpinBox->setValue(
         static_cast<int>(m_socket.getLocalPort()));
+
+    m_ui.m_sessionTimeoutSpinBox->setValue(
+        static_cast<int>(m_socket.getSessionTimeout()));
 }
 
 void UdpProxySocketConfigWidget::portValueChanged(int value)
@@ -88,6 +99,11 @@ void UdpProxySocketConfigWidget::localPortValueChanged(int value)
     m_socket.setLocalPort(static_cast<PortType>(value));
 }
 
+void UdpProxySocketConfigWidget::sessionTimeoutValueChanged(int value)
+{
+    m_socket.setSessionTimeout(static_cast<unsigned>(value));
+}
+
 }  // namespace plugin
 
 }  // namespace cc_tools_qt
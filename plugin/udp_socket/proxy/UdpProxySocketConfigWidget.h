@@ -47,6 +47,7 @@ private slots:
     void hostValueChanged(const QString& value);
     void portValueChanged(int value);
     void localPortValueChanged(int value);
+    void sessionTimeoutValueChanged(int value);
 
 private:
     UdpProxySocket& m_socket;
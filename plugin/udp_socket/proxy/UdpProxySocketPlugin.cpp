@@ -35,6 +35,9 @@ const QString MainConfigKey("cc_udp_proxy_socket");
 const QString HostSubKey("remote_host");
 const QString PortSubKey("remote_port");
 const QString LocalPortSubKey("local_port");
+const QString RecvBatchSizeSubKey("recv_batch_size");
+const QString RecvBufSizeSubKey("recv_buf_size");
+const QString SessionTimeoutSubKey("session_timeout");
 
 }  // namespace
 
@@ -53,6 +56,9 @@ void UdpProxySocketPlugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(HostSubKey, m_socket->getHost());
     subConfig.insert(PortSubKey, m_socket->getPort());
     subConfig.insert(LocalPortSubKey, m_socket->getLocalPort());
+    subConfig.insert(RecvBatchSizeSubKey, m_socket->getRecvBatchSize());
+    subConfig.insert(RecvBufSizeSubKey, m_socket->getRecvBufSize());
+    subConfig.insert(SessionTimeoutSubKey, m_socket->getSessionTimeout());
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -85,6 +91,21 @@ void UdpProxySocketPlugin::reconfigureImpl(const QVariantMap& config)
         auto port = localPortVar.value<PortType>();
         m_socket->setLocalPort(port);
     }
+
+    auto recvBatchSizeVar = subConfig.value(RecvBatchSizeSubKey);
+    if (recvBatchSizeVar.isValid() && recvBatchSizeVar.canConvert<unsigned>()) {
+        m_socket->setRecvBatchSize(recvBatchSizeVar.value<unsigned>());
+    }
+
+    auto recvBufSizeVar = subConfig.value(RecvBufSizeSubKey);
+    if (recvBufSizeVar.isValid() && recvBufSizeVar.canConvert<int>()) {
+        m_socket->setRecvBufSize(recvBufSizeVar.value<int>());
+    }
+
+    auto sessionTimeoutVar = subConfig.value(SessionTimeoutSubKey);
+    if (sessionTimeoutVar.isValid() && sessionTimeoutVar.canConvert<unsigned>()) {
+        m_socket->setSessionTimeout(sessionTimeoutVar.value<unsigned>());
+    }
 }
 
 void UdpProxySocketPlugin::applyInterPluginConfigImpl(const QVariantMap& props)